@@ -58,6 +58,12 @@ public class RD : ModuleRules
 		PublicDefinitions.Add(
 			"nssv_CONFIG_SELECT_STRING_VIEW=nssv_STRING_VIEW_NONSTD");
 		PublicDefinitions.Add("FMT_SHARED");
+		// trace, debug and info messages of the protocol are compiled out, RiderLink logs errors only anyway.
+		// Lower it to SPDLOG_LEVEL_TRACE along with ENABLE_LOG_FILE in RiderLink.Build.cs to debug the protocol.
+		PublicDefinitions.Add("RD_LOG_ACTIVE_LEVEL=SPDLOG_LEVEL_WARN");
+		// RdCall::start_batch sends many requests in one message and RdEndpoint answers them in one message too.
+		// rd-net doesn't understand batches, enable it only when both sides of the protocol are rd-cpp.
+		PublicDefinitions.Add("RD_BATCH_CALLS=0");
 
 		string[] Paths =
 		{
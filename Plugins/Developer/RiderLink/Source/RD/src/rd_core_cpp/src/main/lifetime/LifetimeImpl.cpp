@@ -52,8 +52,8 @@ void LifetimeImpl::attach_nested(std::shared_ptr<LifetimeImpl> nested)
 		return;
 
 	std::function<void()> action = [nested] { nested->terminate(); };
-	counter_t action_id = add_action(action);
-	nested->add_action([this, id = action_id] { actions.erase(id); });
+	action_id_t action_id = add_action(action);
+	nested->add_action([this, id = action_id] { remove_action(id); });
 }
 
 LifetimeImpl::~LifetimeImpl()
@@ -30,14 +30,23 @@ public:
 
 	using counter_t = int32_t;
 
+	/**
+	 * \brief Wide enough never to wrap around, actions are terminated in reverse order of their ids.
+	 */
+	using action_id_t = int64_t;
+
 private:
 	bool eternaled = false;
 	std::atomic<bool> terminated{false};
 
 	counter_t id = 0;
 
-	counter_t action_id_in_map = 0;
-	using actions_t = ordered_map<int, std::function<void()>, rd::hash<int>>;
+	action_id_t action_id_in_map = 0;
+	/**
+	 * \brief Keyed by increasing action id, so iteration order is the order of addition.
+	 * Nested lifetimes remove their entries on termination, which has to stay cheap for short-lived ones.
+	 */
+	using actions_t = std::map<action_id_t, std::function<void()>>;
 	actions_t actions;
 
 	void terminate();
@@ -54,7 +63,7 @@ public:
 	// endregion
 
 	template <typename F>
-	counter_t add_action(F&& action)
+	action_id_t add_action(F&& action)
 	{
 		std::lock_guard<decltype(actions_lock)> guard(actions_lock);
 
@@ -71,7 +80,7 @@ public:
 		return action_id_in_map++;
 	}
 
-	void remove_action(counter_t i)
+	void remove_action(action_id_t i)
 	{
 		std::lock_guard<decltype(actions_lock)> guard(actions_lock);
 
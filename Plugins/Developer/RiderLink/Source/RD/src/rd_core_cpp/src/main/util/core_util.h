@@ -34,10 +34,60 @@
 		throw std::runtime_error(msg); \
 	}
 
+/**
+ * \brief Levels below the floor are compiled out together with their arguments, SPDLOG_LEVEL_TRACE keeps everything.
+ */
+#ifndef RD_LOG_ACTIVE_LEVEL
+#define RD_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
+/**
+ * \brief Formats and evaluates arguments only if [logger] is going to log the message at [level].
+ */
+#define RD_LOG_CALL(logger, level, ...)             \
+	do                                              \
+	{                                               \
+		auto const& rd_log_logger = (logger);       \
+		if (rd_log_logger->should_log(level))       \
+		{                                           \
+			rd_log_logger->log(level, __VA_ARGS__); \
+		}                                           \
+	} while (false)
+
+/**
+ * \brief Compiled out message: [logger] and the arguments are referenced in an unevaluated operand only,
+ * so variables which are there just to be logged don't trigger unused warnings.
+ */
+#define RD_LOG_DISCARD(logger, ...) (void) sizeof(::rd::util::discard_log_args((logger), __VA_ARGS__))
+
+#if RD_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define RD_LOG_TRACE(logger, ...) RD_LOG_CALL(logger, spdlog::level::trace, __VA_ARGS__)
+#else
+#define RD_LOG_TRACE(logger, ...) RD_LOG_DISCARD(logger, __VA_ARGS__)
+#endif
+
+#if RD_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define RD_LOG_DEBUG(logger, ...) RD_LOG_CALL(logger, spdlog::level::debug, __VA_ARGS__)
+#else
+#define RD_LOG_DEBUG(logger, ...) RD_LOG_DISCARD(logger, __VA_ARGS__)
+#endif
+
+#if RD_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define RD_LOG_INFO(logger, ...) RD_LOG_CALL(logger, spdlog::level::info, __VA_ARGS__)
+#else
+#define RD_LOG_INFO(logger, ...) RD_LOG_DISCARD(logger, __VA_ARGS__)
+#endif
+
 namespace rd
 {
 namespace util
 {
+/**
+ * \brief Never called, @see RD_LOG_DISCARD.
+ */
+template <typename... Args>
+int discard_log_args(Args const&...);
+
 template <typename T0, typename... T>
 constexpr std::vector<T0> arrayListOf(T0&& arg, T&&... args)
 {
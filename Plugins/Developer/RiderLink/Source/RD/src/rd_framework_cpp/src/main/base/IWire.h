@@ -22,6 +22,11 @@ class RD_FRAMEWORK_API IWire
 public:
 	Property<bool> connected{false};
 	Property<bool> heartbeatAlive{false};
+	/**
+	 * \brief Token of the counterpart's session, 0 while there is none. Changes whenever state of the counterpart can't be
+	 * relied upon anymore and stays the same across reconnects which were resumed.
+	 */
+	Property<int64_t> session{0};
 
 	// region ctor/dtor
 
@@ -3,8 +3,11 @@
 
 #include "base/RdReactiveBase.h"
 #include "serialization/Polymorphic.h"
+#include "serialization/DeltaCodec.h"
 #include "reactive/Property.h"
 
+#include <memory>
+
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable : 4250)
@@ -21,6 +24,39 @@ protected:
 	mutable int32_t master_version = 0;
 	mutable bool default_value_changed = false;
 
+	/**
+	 * \brief Set by [use_delta_updates].
+	 */
+	mutable std::unique_ptr<DeltaCodec> delta;
+
+	void write_value(Buffer& buffer, T const& v) const
+	{
+		if (delta)
+		{
+			Buffer serialized;
+			S::write(this->get_serialization_context(), serialized, v);
+			delta->write(buffer, std::move(serialized).getRealArray());
+		}
+		else
+		{
+			S::write(this->get_serialization_context(), buffer, v);
+		}
+	}
+
+	void receive(int32_t version, WT v) const
+	{
+		bool rejected = is_master && version < master_version;
+		RD_LOG_TRACE(logReceived, "RECV property {} {}:: oldver={}, ver={}, value = {}{}", to_string(location), to_string(rdid),
+			master_version, version, to_string(v), (rejected ? ">> REJECTED" : ""));
+		if (rejected)
+		{
+			return;
+		}
+		master_version = version;
+
+		Property<T>::set(std::move(v));
+	}
+
 	// init
 public:
 	mutable bool optimize_nested = false;
@@ -50,6 +86,17 @@ public:
 		return default_value_changed;
 	}
 
+	/**
+	 * \brief Opt-in for large plain data values which change slightly: an update carries only the changed region
+	 * of the serialized value when that's smaller. Must be enabled on both sides before binding,
+	 * the wire format isn't understood by a side which doesn't use it.
+	 */
+	void use_delta_updates() const
+	{
+		RD_ASSERT_MSG(!is_bound(), "delta updates must be enabled before binding")
+		delta = std::make_unique<DeltaCodec>();
+	}
+
 	void init(Lifetime lifetime) const override
 	{
 		RdReactiveBase::init(lifetime);
@@ -80,14 +127,20 @@ public:
 			}
 			get_wire()->send(rdid, [this, &v](Buffer& buffer) {
 				buffer.write_integral<int32_t>(master_version);
-				S::write(this->get_serialization_context(), buffer, v);
-				spdlog::get("logSend")->trace("SEND property {} + {}:: ver = {}, value = {}", to_string(location), to_string(rdid),
+				write_value(buffer, v);
+				RD_LOG_TRACE(logSend, "SEND property {} + {}:: ver = {}, value = {}", to_string(location), to_string(rdid),
 					std::to_string(master_version), to_string(v));
 			});
 		});
 
 		get_wire()->advise(lifetime, this);
 
+		if (delta)
+		{
+			// patches sent within the previous session might have been lost
+			get_wire()->session.advise(lifetime, [this](int64_t) { delta->reset(); });
+		}
+
 		if (!optimize_nested)
 		{
 			this->view(lifetime, [this](Lifetime lf, T const& v) {
@@ -102,18 +155,47 @@ public:
 	void on_wire_received(Buffer buffer) const override
 	{
 		int32_t version = buffer.read_integral<int32_t>();
-		WT v = S::read(this->get_serialization_context(), buffer);
-
-		bool rejected = is_master && version < master_version;
-		spdlog::get("logSend")->trace("RECV property {} {}:: oldver={}, ver={}, value = {}{}", to_string(location), to_string(rdid),
-			master_version, version, to_string(v), (rejected ? ">> REJECTED" : ""));
-		if (rejected)
+		if (!delta)
 		{
+			receive(version, S::read(this->get_serialization_context(), buffer));
 			return;
 		}
-		master_version = version;
 
-		Property<T>::set(std::move(v));
+		Buffer::ByteArray serialized;
+		switch (delta->read(buffer, serialized))
+		{
+			case DeltaCodec::ReadResult::Value:
+			{
+				break;
+			}
+			case DeltaCodec::ReadResult::BaseMismatch:
+			{
+				logReceived->error("RECV property {} {}:: ver={}, patch doesn't match the last received value, requesting the whole one",
+					to_string(location), to_string(rdid), version);
+				get_wire()->send(rdid, [this](Buffer& request) {
+					request.write_integral<int32_t>(master_version);
+					delta->write_whole_request(request);
+				});
+				return;
+			}
+			case DeltaCodec::ReadResult::Dropped:
+			{
+				return;
+			}
+			case DeltaCodec::ReadResult::WholeRequested:
+			{
+				if (this->has_value())
+				{
+					get_wire()->send(rdid, [this](Buffer& whole) {
+						whole.write_integral<int32_t>(master_version);
+						write_value(whole, this->get());
+					});
+				}
+				return;
+			}
+		}
+		Buffer value_buffer(std::move(serialized));
+		receive(version, S::read(this->get_serialization_context(), value_buffer));
 	}
 
 	void advise(Lifetime lifetime, std::function<void(T const&)> handler) const override
@@ -28,6 +28,12 @@ class Serializers;
 class RD_FRAMEWORK_API RdReactiveBase : public RdBindableBase, public IRdReactive
 {
 public:
+	/**
+	 * \brief Loggers of received and sent messages, kept here so hot paths don't look them up by name.
+	 */
+	static std::shared_ptr<spdlog::logger> logReceived;
+	static std::shared_ptr<spdlog::logger> logSend;
+
 	// region ctor/dtor
 
 	RdReactiveBase() = default;
@@ -4,6 +4,7 @@
 #include "reactive/Property.h"
 #include "base/IWire.h"
 #include "protocol/MessageBroker.h"
+#include "wire/WireMetrics.h"
 
 #include <rd_framework_export.h>
 
@@ -14,17 +15,27 @@ class RD_FRAMEWORK_API WireBase : public IWire
 protected:
 	IScheduler* scheduler = nullptr;
 
+	mutable WireMetrics metrics;
+
 	MessageBroker message_broker;
 
 public:
 	// region ctor/dtor
-	explicit WireBase(IScheduler* scheduler) : scheduler(scheduler), message_broker(scheduler)
+	explicit WireBase(IScheduler* scheduler) : scheduler(scheduler), message_broker(scheduler, &metrics)
 	{
 	}
 
 	virtual ~WireBase() = default;
 	// endregion
 
+	/**
+	 * \brief Traffic per entity, counted once [WireMetrics::enable] is called.
+	 */
+	WireMetrics& get_metrics() const
+	{
+		return metrics;
+	}
+
 	void advise(Lifetime lifetime, IRdReactive const* entity) const override;
 };
 }	 // namespace rd
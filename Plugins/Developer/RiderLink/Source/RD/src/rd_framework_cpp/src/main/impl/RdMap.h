@@ -125,7 +125,7 @@ public:
 						VS::write(this->get_serialization_context(), buffer, *new_value);
 					}
 
-					spdlog::get("logSend")->trace("SEND{}", logmsg(op, next_version - 1, e.get_key(), new_value));
+					RD_LOG_TRACE(logSend, "SEND{}", logmsg(op, next_version - 1, e.get_key(), new_value));
 				});
 			});
 		});
@@ -186,11 +186,11 @@ public:
 			}
 			if (errmsg.empty())
 			{
-				spdlog::get("logReceived")->trace(logmsg(Op::ACK, version, &(wrapper::get<K>(key))));
+				RD_LOG_TRACE(logReceived, logmsg(Op::ACK, version, &(wrapper::get<K>(key))));
 			}
 			else
 			{
-				spdlog::get("logReceived")->error(logmsg(Op::ACK, version, &(wrapper::get<K>(key))) + " >> " + errmsg);
+				logReceived->error(logmsg(Op::ACK, version, &(wrapper::get<K>(key))) + " >> " + errmsg);
 			}
 		}
 		else
@@ -207,7 +207,7 @@ public:
 
 			if (msg_versioned || !is_master || pendingForAck.count(key) == 0)
 			{
-				spdlog::get("logReceived")->trace("RECV{}", logmsg(op, version, &(wrapper::get<K>(key)), value));
+				RD_LOG_TRACE(logReceived, "RECV{}", logmsg(op, version, &(wrapper::get<K>(key)), value));
 				if (value.has_value())
 				{
 					map::set(std::move(key), *std::move(value));
@@ -219,7 +219,7 @@ public:
 			}
 			else
 			{
-				spdlog::get("logReceived")->trace("{} >> REJECTED", logmsg(op, version, &(wrapper::get<K>(key)), value));
+				RD_LOG_TRACE(logReceived, "{} >> REJECTED", logmsg(op, version, &(wrapper::get<K>(key)), value));
 			}
 
 			if (msg_versioned)
@@ -235,7 +235,7 @@ public:
 				get_wire()->send(rdid, std::move(writer));
 				if (is_master)
 				{
-					spdlog::get("logReceived")->error("Both ends are masters: {}", to_string(location));
+					logReceived->error("Both ends are masters: {}", to_string(location));
 				}
 			}
 		}
@@ -46,6 +46,7 @@ void InternRoot::bind(Lifetime lf, IRdDynamic const* parent, string_view name) c
 		// if something's interned before bind
 		std::lock_guard<decltype(lock)> guard(lock);
 		my_items_lis.clear();
+		my_items_count = 0;
 		other_items_list.clear();
 		inverse_map.clear();
 	}
@@ -65,7 +66,11 @@ void InternRoot::set_interned_correspondence(int32_t id, InternedAny&& value) co
 	RD_ASSERT_MSG(!is_index_owned(id), "Setting interned correspondence for object that we should have written, bug?")
 
 	std::lock_guard<decltype(lock)> guard(lock);
-	other_items_list[id / 2] = value;
-	inverse_map[value] = id;
+	const bool stored = other_items_list.set(id / 2, value);
+	RD_ASSERT_MSG(stored, "Interned id " + std::to_string(id) + " was received twice in " + to_string(location));
+	if (stored)
+	{
+		inverse_map.insert(value, id);
+	}
 }
 }	 // namespace rd
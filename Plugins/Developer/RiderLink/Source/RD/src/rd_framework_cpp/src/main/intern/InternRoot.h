@@ -7,10 +7,9 @@
 #include "types/wrapper.h"
 #include "serialization/RdAny.h"
 #include "util/core_traits.h"
+#include "util/segmented_store.h"
+#include "util/striped_map.h"
 
-#include "tsl/ordered_map.h"
-
-#include <vector>
 #include <string>
 #include <mutex>
 
@@ -37,15 +36,20 @@ class RD_FRAMEWORK_API InternRoot final : public RdReactiveBase
 {
 private:
 	// template<typename T>
-	mutable std::vector<InternedAny> my_items_lis;
+	mutable util::segmented_store<InternedAny> my_items_lis;
+	mutable int32_t my_items_count = 0;
 
 	// template<typename T>
-	mutable ordered_map<int32_t, InternedAny> other_items_list;
+	mutable util::segmented_store<InternedAny> other_items_list;
 	// template<typename T>
-	mutable ordered_map<InternedAny, int32_t, any::TransparentHash, any::TransparentKeyEqual> inverse_map;
+	mutable util::striped_map<InternedAny, int32_t, any::TransparentHash, any::TransparentKeyEqual> inverse_map;
 
 	mutable InternScheduler intern_scheduler;
 
+	/**
+	 * \brief Serializes writers: assigning our own ids and storing values received from the counterpart.
+	 * Recursive because writing a polymorphic value may intern its nested values.
+	 */
 	mutable std::recursive_mutex lock;
 
 	void set_interned_correspondence(int32_t id, InternedAny&& value) const;
@@ -95,8 +99,10 @@ constexpr bool InternRoot::is_index_owned(int32_t id)
 template <typename T>
 Wrapper<T> InternRoot::un_intern_value(int32_t id) const
 {
-	// don't need lock because value's already exists and never removes
-	return any::get<T>(is_index_owned(id) ? my_items_lis[id / 2] : other_items_list[id / 2]);
+	// lock-free: stored values never move and are never removed while bound
+	InternedAny const* value = is_index_owned(id) ? my_items_lis.get(id / 2) : other_items_list.get(id / 2);
+	RD_ASSERT_THROW_MSG(value != nullptr, "Unknown interned id " + std::to_string(id) + " in " + to_string(location));
+	return any::get<T>(*value);
 }
 
 template <typename T>
@@ -104,30 +110,29 @@ int32_t InternRoot::intern_value(Wrapper<T> value) const
 {
 	InternedAny any = any::make_interned_any<T>(value);
 
-	std::lock_guard<decltype(lock)> guard(lock);
-
-	auto it = inverse_map.find(any);
-	int32_t index = 0;
-	if (it == inverse_map.end())
-	{
-		get_protocol()->get_wire()->send(this->rdid, [this, &index, value, any](Buffer& buffer) {
-			InternedAnySerializer::write<T>(get_serialization_context(), buffer, wrapper::get<T>(value));
-			{
-				std::lock_guard<decltype(lock)> guard(lock);
-				index = static_cast<int32_t>(my_items_lis.size()) * 2;
-				my_items_lis.emplace_back(any);
-			}
-			buffer.write_integral<int32_t>(index);
-		});
-	}
-	else
+	// unlike un_intern_value this takes a lock, but only the stripe of [any] and not the root-wide one
+	if (auto index = inverse_map.find(any))
 	{
-		index = it->second;
+		return *index;
 	}
-	if (inverse_map.count(any) == 0)
+
+	std::lock_guard<decltype(lock)> guard(lock);
+	// somebody might have interned the same value while we were waiting
+	if (auto index = inverse_map.find(any))
 	{
-		inverse_map[any] = index;
+		return *index;
 	}
+
+	const int32_t index = my_items_count * 2;
+	const bool stored = my_items_lis.set(index / 2, any);
+	RD_ASSERT_MSG(stored, "Interned id " + std::to_string(index) + " is taken already in " + to_string(location));
+	++my_items_count;
+	get_protocol()->get_wire()->send(this->rdid, [this, index, &value](Buffer& buffer) {
+		InternedAnySerializer::write<T>(get_serialization_context(), buffer, wrapper::get<T>(value));
+		buffer.write_integral<int32_t>(index);
+	});
+	// published only after the value is sent, so any message referring to the index goes after it
+	inverse_map.insert(any, index);
 	return index;
 }
 }	 // namespace rd
@@ -1,130 +1,231 @@
 #include "protocol/MessageBroker.h"
 
+#include "scheduler/SynchronousScheduler.h"
+
 #include "spdlog/sinks/stdout_color_sinks.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace rd
 {
 std::shared_ptr<spdlog::logger> MessageBroker::logger =
 	spdlog::stderr_color_mt<spdlog::synchronous_factory>("logger", spdlog::color_mode::automatic);
 
-static void execute(const IRdReactive* that, Buffer msg)
+static void execute(RdId const& id, const IRdReactive* that, Buffer msg, WireMetrics const* metrics)
 {
 	msg.read_integral<int16_t>();	   // skip context
+	if (metrics == nullptr || !metrics->is_enabled())
+	{
+		that->on_wire_received(std::move(msg));
+		return;
+	}
+	const auto start = std::chrono::steady_clock::now();
 	that->on_wire_received(std::move(msg));
+	// [that] may have unsubscribed and freed itself while handling the message
+	metrics->on_handled(id, std::chrono::steady_clock::now() - start);
+}
+
+void MessageBroker::invoke(IScheduler* scheduler, std::vector<delivery_t> deliveries) const
+{
+	// entities on the synchronous scheduler (e.g. call tasks) are freed from other threads,
+	// they are handled under the lock like they were when the whole dispatch was synchronized
+	const bool synchronous = scheduler == &SynchronousScheduler::Instance();
+	auto action = [this, synchronous, deliveries = std::move(deliveries)]() mutable {
+		for (auto& delivery : deliveries)
+		{
+			// an entity is freed right after its subscription is erased, an earlier message of the batch might have done it
+			std::unique_lock<decltype(lock)> guard(lock);
+			if (subscriptions.find(delivery.id) != delivery.entity)
+			{
+				RD_LOG_TRACE(logger, "Disappeared Handler for Reactive entities with id: {}", to_string(delivery.id));
+				continue;
+			}
+			if (!synchronous)
+			{
+				guard.unlock();
+			}
+			execute(delivery.id, delivery.entity, std::move(delivery.message), metrics);
+		}
+	};
+	std::function<void()> function = util::make_shared_function(std::move(action));
+	scheduler->queue(std::move(function));
+}
+
+MessageBroker::MessageBroker(IScheduler* defaultScheduler, WireMetrics const* metrics)
+	: default_scheduler(defaultScheduler), metrics(metrics)
+{
 }
 
-void MessageBroker::invoke(const IRdReactive* that, Buffer msg, bool sync) const
+void MessageBroker::deliver_buffered(RdId id) const
 {
-	if (sync)
+	IRdReactive const* subscription = nullptr;
+	IScheduler* scheduler = nullptr;
+	optional<Buffer> message;
+	optional<Mq> drained;
 	{
-		execute(that, std::move(msg));
+		std::lock_guard<decltype(lock)> guard(lock);
+		auto it = broker.find(id);
+		if (it == broker.end())
+		{
+			return;
+		}
+		subscription = subscriptions.find(id);
+		if (subscription != nullptr)
+		{
+			scheduler = subscription->get_wire_scheduler();
+		}
+
+		auto& current = it->second;
+		if (!current.default_scheduler_messages.empty())
+		{
+			message = make_optional<Buffer>(std::move(current.default_scheduler_messages.front()));
+			current.default_scheduler_messages.pop();
+		}
+		if (current.default_scheduler_messages.empty())
+		{
+			drained = make_optional<Mq>(std::move(current));
+			broker.erase(it);
+			--buffered_ids;
+		}
 	}
-	else
+
+	if (subscription != nullptr)
 	{
-		auto action = [this, that, message = std::move(msg)]() mutable {
-			bool exists_id = false;
-			{
-				std::lock_guard<decltype(lock)> guard(lock);
-				exists_id = subscriptions.count(that->rdid) > 0;
-			}
-			if (exists_id)
+		if (message)
+		{
+			if (scheduler == default_scheduler)
 			{
-				execute(that, std::move(message));
+				// entities of the default scheduler are unsubscribed on it, so nothing freed it since the lookup
+				execute(id, subscription, *std::move(message), metrics);
 			}
 			else
 			{
-				logger->trace("Disappeared Handler for Reactive entities with id: {}", to_string(that->rdid));
+				std::vector<delivery_t> deliveries;
+				deliveries.push_back({id, subscription, *std::move(message)});
+				invoke(scheduler, std::move(deliveries));
 			}
-		};
-		std::function<void()> function = util::make_shared_function(std::move(action));
-		that->get_wire_scheduler()->queue(std::move(function));
+		}
+	}
+	else
+	{
+		RD_LOG_TRACE(logger, "No handler for id: {}", to_string(id));
+	}
+
+	// messages held back behind the buffered ones have nobody to go to if the entity has unsubscribed meanwhile
+	if (drained && !drained->custom_scheduler_messages.empty() && subscription != nullptr)
+	{
+		RD_ASSERT_MSG(scheduler != default_scheduler, "require equals of wire and default schedulers")
+		std::vector<delivery_t> deliveries;
+		deliveries.reserve(drained->custom_scheduler_messages.size());
+		for (auto& it : drained->custom_scheduler_messages)
+		{
+			deliveries.push_back({id, subscription, std::move(it)});
+		}
+		invoke(scheduler, std::move(deliveries));
 	}
 }
 
-MessageBroker::MessageBroker(IScheduler* defaultScheduler) : default_scheduler(defaultScheduler)
+void MessageBroker::dispatch(RdId id, Buffer message) const
 {
+	batch_t messages;
+	messages.emplace_back(id, std::move(message));
+	dispatch(std::move(messages));
 }
 
-void MessageBroker::dispatch(RdId id, Buffer message) const
+void MessageBroker::dispatch(batch_t messages) const
 {
-	RD_ASSERT_MSG(!id.isNull(), "id mustn't be null")
+	// all messages of one id end up on the same scheduler, so a single task per scheduler keeps per-id ordering
+	std::vector<std::pair<IScheduler*, std::vector<delivery_t>>> per_scheduler;
+	std::vector<RdId> buffered;
 
-	{	 // synchronized recursively
-		std::lock_guard<decltype(lock)> guard(lock);
-		IRdReactive const* s = subscriptions[id];
+	// [s] has to be alive, the lock or a read section of [subscriptions] ensures it
+	auto enqueue = [&per_scheduler](RdId const& id, IRdReactive const* s, Buffer& message) {
+		IScheduler* scheduler = s->get_wire_scheduler();
+		auto it = std::find_if(per_scheduler.begin(), per_scheduler.end(),
+			[scheduler](std::pair<IScheduler*, std::vector<delivery_t>> const& p) { return p.first == scheduler; });
+		if (it == per_scheduler.end())
+		{
+			per_scheduler.emplace_back(scheduler, std::vector<delivery_t>{});
+			it = std::prev(per_scheduler.end());
+		}
+		it->second.push_back({id, s, std::move(message)});
+	};
+
+	// lock is taken lazily and held for the rest of the batch, so later messages of an id see its buffered ones
+	std::unique_lock<decltype(lock)> guard(lock, std::defer_lock);
+	for (auto& item : messages)
+	{
+		RdId const& id = item.first;
+		RD_ASSERT_MSG(!id.isNull(), "id mustn't be null")
+
+		if (!guard.owns_lock())
+		{
+			const bool enqueued = subscriptions.read(id, [&](IRdReactive const* s) {
+				if (s == nullptr || !(s->get_wire_scheduler() == default_scheduler ||
+										 s->get_wire_scheduler()->out_of_order_execution || buffered_ids == 0))
+				{
+					return false;
+				}
+				enqueue(id, s, item.second);
+				return true;
+			});
+			if (enqueued)
+			{
+				continue;
+			}
+			guard.lock();
+		}
+
+		IRdReactive const* s = subscriptions.find(id);
 		if (s == nullptr)
 		{
 			auto it = broker.find(id);
 			if (it == broker.end())
 			{
 				it = broker.emplace(id, Mq{}).first;
+				++buffered_ids;
 			}
-
-			broker[id].default_scheduler_messages.emplace(std::move(message));
-
-			auto action = [this, it, id]() mutable {
-				auto& current = it->second;
-				IRdReactive const* subscription = subscriptions[id];
-
-				optional<Buffer> message;
-				{
-					std::lock_guard<decltype(lock)> guard(lock);
-					if (!current.default_scheduler_messages.empty())
-					{
-						message = make_optional<Buffer>(std::move(current.default_scheduler_messages.front()));
-						current.default_scheduler_messages.pop();
-					}
-				}
-				if (subscription != nullptr)
-				{
-					if (message)
-					{
-						invoke(subscription, *std::move(message), subscription->get_wire_scheduler() == default_scheduler);
-					}
-				}
-				else
-				{
-					logger->trace("No handler for id: {}", to_string(id));
-				}
-
-				if (current.default_scheduler_messages.empty())
-				{
-					auto t = std::move(broker[id]);
-					broker.erase(id);
-					for (auto& it : t.custom_scheduler_messages)
-					{
-						RD_ASSERT_MSG(subscription->get_wire_scheduler() != default_scheduler,
-							"require equals of wire and default schedulers")
-						invoke(subscription, std::move(it));
-					}
-				}
-			};
-			std::function<void()> function = util::make_shared_function(std::move(action));
-			default_scheduler->queue(std::move(function));
+			it->second.default_scheduler_messages.emplace(std::move(item.second));
+			buffered.push_back(id);
+		}
+		else if (s->get_wire_scheduler() == default_scheduler || s->get_wire_scheduler()->out_of_order_execution)
+		{
+			enqueue(id, s, item.second);
 		}
 		else
 		{
-			if (s->get_wire_scheduler() == default_scheduler || s->get_wire_scheduler()->out_of_order_execution)
+			auto it = broker.find(id);
+			if (it == broker.end())
 			{
-				invoke(s, std::move(message));
+				enqueue(id, s, item.second);
 			}
 			else
 			{
-				auto it = broker.find(id);
-				if (it == broker.end())
-				{
-					invoke(s, std::move(message));
-				}
-				else
-				{
-					Mq& mq = it->second;
-					mq.custom_scheduler_messages.push_back(std::move(message));
-				}
+				it->second.custom_scheduler_messages.push_back(std::move(item.second));
 			}
 		}
 	}
+	if (guard.owns_lock())
+	{
+		guard.unlock();
+	}
 
-	//        }
+	if (!buffered.empty())
+	{
+		auto action = [this, ids = std::move(buffered)]() {
+			for (RdId const& id : ids)
+			{
+				deliver_buffered(id);
+			}
+		};
+		std::function<void()> function = util::make_shared_function(std::move(action));
+		default_scheduler->queue(std::move(function));
+	}
+	for (auto& it : per_scheduler)
+	{
+		invoke(it.first, std::move(it.second));
+	}
 }
 
 void MessageBroker::advise_on(Lifetime lifetime, IRdReactive const* entity) const
@@ -138,9 +239,11 @@ void MessageBroker::advise_on(Lifetime lifetime, IRdReactive const* entity) cons
 	if (!lifetime->is_terminated())
 	{
 		auto key = entity->rdid;
-		IRdReactive const* value = entity;
-		subscriptions[key] = value;
-		lifetime->add_action([this, key]() { subscriptions.erase(key); });
+		subscriptions.put(key, entity);
+		lifetime->add_action([this, key, entity]() {
+			std::lock_guard<decltype(lock)> guard(lock);
+			subscriptions.erase(key, entity);
+		});
 	}
 }
 }	 // namespace rd
@@ -7,12 +7,16 @@
 #endif
 
 #include "base/IRdReactive.h"
+#include "protocol/SubscriptionTable.h"
+#include "wire/WireMetrics.h"
 
 #include "std/unordered_map.h"
 
 #include "spdlog/spdlog.h"
 
 #include <queue>
+#include <utility>
+#include <vector>
 
 #include <rd_framework_export.h>
 
@@ -40,25 +44,50 @@ public:
 
 class RD_FRAMEWORK_API MessageBroker final
 {
+public:
+	using message_t = std::pair<RdId, Buffer>;
+
+	using batch_t = std::vector<message_t>;
+
 private:
+	struct delivery_t
+	{
+		RdId id;
+		IRdReactive const* entity;
+		Buffer message;
+	};
+
 	IScheduler* default_scheduler = nullptr;
-	mutable rd::unordered_map<RdId, IRdReactive const*> subscriptions;
+	WireMetrics const* metrics = nullptr;
+	mutable SubscriptionTable subscriptions;
 	mutable rd::unordered_map<RdId, Mq> broker;
+	/**
+	 * \brief Size of [broker], readable without taking [lock].
+	 */
+	mutable std::atomic<size_t> buffered_ids{0};
 
 	mutable std::recursive_mutex lock;
 
 	static std::shared_ptr<spdlog::logger> logger;
 
-	void invoke(const IRdReactive* that, Buffer msg, bool sync = false) const;
+	void invoke(IScheduler* scheduler, std::vector<delivery_t> deliveries) const;
+
+	void deliver_buffered(RdId id) const;
 
 public:
 	// region ctor/dtor
 
-	explicit MessageBroker(IScheduler* defaultScheduler);
+	explicit MessageBroker(IScheduler* defaultScheduler, WireMetrics const* metrics = nullptr);
 	// endregion
 
 	void dispatch(RdId id, Buffer message) const;
 
+	/**
+	 * \brief Dispatches messages received together, posting a single task per target scheduler.
+	 * Messages addressed to the same entity are delivered in the order they appear in [messages].
+	 */
+	void dispatch(batch_t messages) const;
+
 	void advise_on(Lifetime lifetime, IRdReactive const* entity) const;
 };
 }	 // namespace rd
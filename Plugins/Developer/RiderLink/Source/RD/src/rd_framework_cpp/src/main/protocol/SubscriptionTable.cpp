@@ -0,0 +1,127 @@
+#include "protocol/SubscriptionTable.h"
+
+#include <cstdint>
+
+namespace rd
+{
+constexpr SubscriptionTable::key_t SubscriptionTable::EMPTY;
+constexpr size_t SubscriptionTable::MIN_CAPACITY;
+
+SubscriptionTable::slot_t& SubscriptionTable::table_t::locate(key_t key) const
+{
+	// ids are hashes already, fibonacci hashing just spreads them over the low bits
+	size_t i = static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+	while (true)
+	{
+		slot_t& slot = slots[i];
+		key_t current = slot.key.load(std::memory_order_acquire);
+		if (current == key || current == EMPTY)
+		{
+			return slot;
+		}
+		i = (i + 1) & mask;
+	}
+}
+
+SubscriptionTable::SubscriptionTable() : table(new table_t(MIN_CAPACITY))
+{
+}
+
+SubscriptionTable::~SubscriptionTable()
+{
+	delete table.load();
+	for (auto* it : retired)
+	{
+		delete it;
+	}
+}
+
+IRdReactive const* SubscriptionTable::lookup(RdId const& id) const
+{
+	slot_t const& slot = table.load()->locate(id.get_hash());
+	// an empty slot has no value either
+	return slot.value.load(std::memory_order_acquire);
+}
+
+IRdReactive const* SubscriptionTable::find(RdId const& id) const
+{
+	const util::epoch_guard::read_section section(readers);
+	return lookup(id);
+}
+
+void SubscriptionTable::rehash(size_t capacity)
+{
+	table_t* current = table.load();
+	auto* next = new table_t(capacity);
+	for (size_t i = 0; i <= current->mask; ++i)
+	{
+		slot_t const& slot = current->slots[i];
+		IRdReactive const* value = slot.value.load(std::memory_order_relaxed);
+		if (value != nullptr)
+		{
+			slot_t& target = next->locate(slot.key.load(std::memory_order_relaxed));
+			target.value.store(value, std::memory_order_relaxed);
+			target.key.store(slot.key.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			++next->used;
+		}
+	}
+
+	retired.push_back(table.exchange(next));
+	// any lookup that starts from now on sees [next], so nobody can hold retired tables once readers drained
+	if (readers.is_idle())
+	{
+		for (auto* it : retired)
+		{
+			delete it;
+		}
+		retired.clear();
+	}
+}
+
+void SubscriptionTable::put(RdId const& id, IRdReactive const* entity)
+{
+	const key_t key = id.get_hash();
+	table_t* current = table.load();
+	slot_t* slot = &current->locate(key);
+	if (slot->key.load(std::memory_order_relaxed) == key)
+	{
+		if (slot->value.load(std::memory_order_relaxed) == nullptr)
+		{
+			++live;
+		}
+		slot->value.store(entity, std::memory_order_release);
+		return;
+	}
+
+	// keep at least half of the slots empty, so probe sequences stay short and always terminate
+	if ((current->used + 1) * 2 > current->mask + 1)
+	{
+		size_t capacity = MIN_CAPACITY;
+		while (capacity < (live + 1) * 4)
+		{
+			capacity *= 2;
+		}
+		rehash(capacity);
+		current = table.load();
+		slot = &current->locate(key);
+	}
+	slot->value.store(entity, std::memory_order_relaxed);
+	// publishes value together with the key
+	slot->key.store(key, std::memory_order_release);
+	++current->used;
+	++live;
+}
+
+void SubscriptionTable::erase(RdId const& id, IRdReactive const* entity)
+{
+	const key_t key = id.get_hash();
+	slot_t& slot = table.load()->locate(key);
+	if (slot.key.load(std::memory_order_relaxed) == key && slot.value.load(std::memory_order_relaxed) == entity)
+	{
+		slot.value.store(nullptr, std::memory_order_seq_cst);
+		--live;
+	}
+	// even an entity replaced by [put] could have been found before
+	readers.synchronize();
+}
+}	 // namespace rd
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifndef RD_CPP_SUBSCRIPTIONTABLE_H
+#define RD_CPP_SUBSCRIPTIONTABLE_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "protocol/RdId.h"
+#include "util/epoch_guard.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+// region predeclared
+
+class IRdReactive;
+// endregion
+
+/**
+ * \brief Read-mostly map from [RdId] to subscribed entity.
+ *
+ * Open addressing table with linear probing. Lookups never block: keys are never removed from a table,
+ * erasing a subscription only clears its value, so a probe sequence observed by a lookup stays valid.
+ * Writers must be serialized by the caller. When erased slots pile up (e.g. ids of finished calls) live entries
+ * are rehashed into a new table which is published atomically, replaced tables are reclaimed once no lookup is in flight.
+ *
+ * Entities aren't owned by the table, [read] is the only way to dereference one without the caller's lock:
+ * [erase] synchronizes with the readers which could still see the erased entity, so it can be freed as soon as it returns.
+ */
+class RD_FRAMEWORK_API SubscriptionTable final
+{
+	using key_t = RdId::hash_t;
+
+	/**
+	 * \brief Key of a never used slot, hash of the null id which is never subscribed.
+	 */
+	static constexpr key_t EMPTY = 0;
+
+	struct slot_t
+	{
+		std::atomic<key_t> key{EMPTY};
+		std::atomic<IRdReactive const*> value{nullptr};
+	};
+
+	struct table_t
+	{
+		size_t mask;
+		std::unique_ptr<slot_t[]> slots;
+		/**
+		 * \brief Number of slots with a key, cleared ones included.
+		 */
+		size_t used = 0;
+
+		explicit table_t(size_t capacity) : mask(capacity - 1), slots(new slot_t[capacity])
+		{
+		}
+
+		slot_t& locate(key_t key) const;
+	};
+
+	static constexpr size_t MIN_CAPACITY = 64;
+
+	std::atomic<table_t*> table;
+
+	size_t live = 0;
+
+	util::epoch_guard readers;
+
+	std::vector<table_t*> retired;
+
+	void rehash(size_t capacity);
+
+	IRdReactive const* lookup(RdId const& id) const;
+
+public:
+	// region ctor/dtor
+
+	SubscriptionTable();
+
+	SubscriptionTable(SubscriptionTable const&) = delete;
+
+	SubscriptionTable& operator=(SubscriptionTable const&) = delete;
+
+	~SubscriptionTable();
+	// endregion
+
+	/**
+	 * \brief Entity subscribed to [id], it may be freed right away unless the caller holds the lock serializing writers.
+	 */
+	IRdReactive const* find(RdId const& id) const;
+
+	/**
+	 * \brief Calls [reader] with the entity subscribed to [id] or nullptr, the entity stays alive until it returns.
+	 * [erase] waits for [reader], so it has to be short and mustn't take the lock serializing writers.
+	 */
+	template <typename F>
+	auto read(RdId const& id, F&& reader) const -> decltype(reader(nullptr))
+	{
+		const util::epoch_guard::read_section section(readers);
+		return reader(lookup(id));
+	}
+
+	void put(RdId const& id, IRdReactive const* entity);
+
+	/**
+	 * \brief Removes subscription of [id] if it's still held by [entity], [entity] may be freed once it returns.
+	 */
+	void erase(RdId const& id, IRdReactive const* entity);
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+
+#endif	  // RD_CPP_SUBSCRIPTIONTABLE_H
@@ -1,55 +1,184 @@
 #include "SingleThreadSchedulerBase.h"
 
 #include "util/core_util.h"
+#include <util/thread_util.h>
 
-#include "ctpl_stl.h"
 #include "spdlog/include/spdlog/sinks/stdout_color_sinks.h"
 
 namespace rd
 {
-SingleThreadSchedulerBase::PoolTask::PoolTask(std::function<void()> f, SingleThreadSchedulerBase* scheduler)
-	: f(std::move(f)), scheduler(scheduler)
+SingleThreadSchedulerBase::SingleThreadSchedulerBase(std::string name)
+	: log(spdlog::stderr_color_mt<spdlog::synchronous_factory>(name, spdlog::color_mode::automatic))
+	, name(std::move(name))
+	, queue_head(&stub)
+	, queue_tail(&stub)
+	, worker([this] { thread_proc(); })
+{
+	thread_id = worker.get_id();
+}
+
+void SingleThreadSchedulerBase::push(TaskNode* node)
+{
+	node->next.store(nullptr, std::memory_order_relaxed);
+	TaskNode* prev = queue_head.exchange(node);
+	prev->next.store(node, std::memory_order_release);
+}
+
+SingleThreadSchedulerBase::TaskNode* SingleThreadSchedulerBase::pop()
+{
+	TaskNode* tail = queue_tail;
+	TaskNode* next = tail->next.load(std::memory_order_acquire);
+	if (tail == &stub)
+	{
+		if (next == nullptr)
+		{
+			return nullptr;
+		}
+		queue_tail = next;
+		tail = next;
+		next = next->next.load(std::memory_order_acquire);
+	}
+	if (next != nullptr)
+	{
+		queue_tail = next;
+		return tail;
+	}
+	if (tail != queue_head.load())
+	{
+		// producer has swapped the head but hasn't linked its node yet
+		return nullptr;
+	}
+	push(&stub);
+	next = tail->next.load(std::memory_order_acquire);
+	if (next != nullptr)
+	{
+		queue_tail = next;
+		return tail;
+	}
+	return nullptr;
+}
+
+bool SingleThreadSchedulerBase::has_pending() const
 {
+	return queue_tail->next.load() != nullptr || queue_head.load() != queue_tail;
 }
 
-void SingleThreadSchedulerBase::PoolTask::operator()(int id) const
+void SingleThreadSchedulerBase::run(TaskNode* node)
 {
 	try
 	{
-		f();
-		--scheduler->tasks_executing;
+		node->action();
 	}
 	catch (std::exception const& e)
 	{
-		scheduler->log->error("Background task failed, scheduler={}, thread_id={} | {}", scheduler->name, id, e.what());
-		--scheduler->tasks_executing;
+		log->error("Background task failed, scheduler={} | {}", name, e.what());
+	}
+	delete node;
+
+	if (--tasks_executing == 0 && flush_waiters.load() > 0)
+	{
+		std::lock_guard<decltype(park_lock)> guard(park_lock);
+		flush_cv.notify_all();
 	}
 }
 
-SingleThreadSchedulerBase::SingleThreadSchedulerBase(std::string name)
-	: log(spdlog::stderr_color_mt<spdlog::synchronous_factory>(name, spdlog::color_mode::automatic))
-	, name(std::move(name))
-	, pool(std::make_unique<ctpl::thread_pool>(1))
+void SingleThreadSchedulerBase::thread_proc()
+{
+	util::set_thread_name(name.c_str());
+
+	while (true)
+	{
+		if (TaskNode* node = pop())
+		{
+			run(node);
+			continue;
+		}
+
+		std::unique_lock<decltype(park_lock)> ul(park_lock);
+		worker_parked = true;
+		worker_cv.wait(ul, [this]() -> bool { return has_pending() || stopping; });
+		worker_parked = false;
+		if (stopping && !has_pending())
+		{
+			return;
+		}
+	}
+}
+
+void SingleThreadSchedulerBase::stop()
+{
+	if (!worker.joinable())
+	{
+		return;
+	}
+	RD_ASSERT_THROW_MSG(!is_active(), "Can't stop scheduler " + name + " from its own thread");
+
+	{
+		std::lock_guard<decltype(park_lock)> guard(park_lock);
+		stopping = true;
+		worker_cv.notify_one();
+	}
+	worker.join();
+
+	std::lock_guard<decltype(park_lock)> guard(park_lock);
+	drop_pending();
+	drained = true;
+}
+
+void SingleThreadSchedulerBase::drop_pending()
 {
-	RD_ASSERT_THROW_MSG(pool->size() == 1, "Thread pool wasn't properly initalized");
-	thread_id = pool->get_thread(0).get_id();
+	// actions which raced with stop are never going to be executed
+	while (TaskNode* node = pop())
+	{
+		delete node;
+		--tasks_executing;
+	}
+	flush_cv.notify_all();
 }
 
 void SingleThreadSchedulerBase::flush()
 {
 	RD_ASSERT_MSG(!is_active(), "Can't flush this scheduler in a reentrant way: we are inside queued item's execution");
 
-	while (tasks_executing != 0)
+	if (tasks_executing == 0)
 	{
-		std::this_thread::yield();
+		return;
 	}
+
+	++flush_waiters;
+	{
+		std::unique_lock<decltype(park_lock)> ul(park_lock);
+		flush_cv.wait(ul, [this]() -> bool { return tasks_executing == 0; });
+	}
+	--flush_waiters;
 }
 
 void SingleThreadSchedulerBase::queue(std::function<void()> action)
 {
+	if (stopping)
+	{
+		RD_LOG_DEBUG(log, "{}: action was queued after the scheduler had stopped", name);
+		return;
+	}
+
 	++tasks_executing;
-	PoolTask task(action, this);
-	pool->push(std::move(task));
+	push(new TaskNode(std::move(action)));
+
+	if (worker_parked.load())
+	{
+		std::lock_guard<decltype(park_lock)> guard(park_lock);
+		worker_cv.notify_one();
+	}
+
+	if (stopping)
+	{
+		// stop() may have drained the queue before this node was pushed, nobody else would free it then
+		std::lock_guard<decltype(park_lock)> guard(park_lock);
+		if (drained)
+		{
+			drop_pending();
+		}
+	}
 }
 
 bool SingleThreadSchedulerBase::is_active() const
@@ -57,5 +186,15 @@ bool SingleThreadSchedulerBase::is_active() const
 	return thread_id == std::this_thread::get_id();
 }
 
-SingleThreadSchedulerBase::~SingleThreadSchedulerBase() = default;
-}	 // namespace rd
\ No newline at end of file
+SingleThreadSchedulerBase::~SingleThreadSchedulerBase()
+{
+	try
+	{
+		stop();
+	}
+	catch (std::exception const& e)
+	{
+		log->error("Failed to terminate {} | {}", name, e.what());
+	}
+}
+}	 // namespace rd
@@ -10,38 +10,93 @@
 #include "lifetime/Lifetime.h"
 #include "spdlog/spdlog.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include <rd_framework_export.h>
 
-namespace ctpl
-{
-class thread_pool;
-}
-
 namespace rd
 {
+/**
+ * \brief Scheduler which executes queued actions one by one on its own dedicated thread.
+ *
+ * Producers push into an intrusive lock-free MPSC queue, so [queue] never takes a lock while the worker is busy.
+ * The worker and [flush] callers park on a condition variable when there is nothing to do instead of spinning.
+ */
 class RD_FRAMEWORK_API SingleThreadSchedulerBase : public IScheduler
 {
 protected:
 	std::shared_ptr<spdlog::logger> log;
 	std::string name;
 
+	/**
+	 * \brief Number of actions which were queued but haven't finished execution yet.
+	 */
 	std::atomic_uint32_t tasks_executing{0};
 	std::atomic_uint32_t active{0};
-	std::unique_ptr<ctpl::thread_pool> pool;
 
-	class PoolTask
+	struct TaskNode
 	{
-		std::function<void()> f;
-		SingleThreadSchedulerBase* scheduler;
+		std::atomic<TaskNode*> next{nullptr};
+		std::function<void()> action;
 
-	public:
-		explicit PoolTask(std::function<void()> f, SingleThreadSchedulerBase* scheduler);
+		TaskNode() = default;
 
-		void operator()(int id) const;
+		explicit TaskNode(std::function<void()> action) : action(std::move(action))
+		{
+		}
 	};
 
+	// region queue
+	/**
+	 * \brief Most recently pushed node, producers swap themselves in here.
+	 */
+	std::atomic<TaskNode*> queue_head;
+	/**
+	 * \brief Last consumed node, touched only by the worker thread.
+	 */
+	TaskNode* queue_tail;
+	TaskNode stub;
+	// endregion
+
+	// region parking
+	std::mutex park_lock;
+	std::condition_variable worker_cv;
+	std::condition_variable flush_cv;
+	std::atomic_bool worker_parked{false};
+	std::atomic_uint32_t flush_waiters{0};
+	std::atomic_bool stopping{false};
+	/**
+	 * \brief Set by [stop] once the worker is joined, guarded by park_lock.
+	 */
+	bool drained = false;
+	// endregion
+
+	std::thread worker;
+
+	void push(TaskNode* node);
+
+	TaskNode* pop();
+
+	bool has_pending() const;
+
+	void run(TaskNode* node);
+
+	void thread_proc();
+
+	/**
+	 * \brief Frees actions which will never run, called with park_lock held once the worker is gone.
+	 */
+	void drop_pending();
+
+	/**
+	 * \brief Executes everything queued so far and joins the worker thread. Actions queued afterwards are dropped.
+	 */
+	void stop();
+
 public:
 	// region ctor/dtor
 	SingleThreadSchedulerBase(std::string name);
@@ -0,0 +1,197 @@
+#include "serialization/DeltaCodec.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace rd
+{
+namespace
+{
+// FNV-1a, only has to be the same on both sides of this codec
+int64_t content_hash(Buffer::ByteArray const& bytes)
+{
+	uint64_t result = 14695981039346656037ull;
+	for (auto byte : bytes)
+	{
+		result = (result ^ byte) * 1099511628211ull;
+	}
+	return static_cast<int64_t>(result);
+}
+
+/**
+ * \brief Copy [copy] bytes of the base, skip [skip] more of them and put [insert] instead.
+ */
+struct run_t
+{
+	size_t copy;
+	size_t skip;
+	size_t insert_from;
+	size_t insert_size;
+};
+
+enum class Kind : uint8_t
+{
+	Whole,
+	Patch,
+	WholeRequest
+};
+
+// copy, skip and insert sizes
+constexpr size_t RUN_HEADER_SIZE = 3 * sizeof(int32_t);
+
+// base hash and number of runs
+constexpr size_t PATCH_HEADER_SIZE = sizeof(int64_t) + sizeof(int32_t);
+
+std::vector<run_t> diff(Buffer::ByteArray const& base, Buffer::ByteArray const& value)
+{
+	std::vector<run_t> runs;
+	const size_t common = (std::min)(base.size(), value.size());
+	size_t prefix = 0;
+	while (prefix < common && base[prefix] == value[prefix])
+	{
+		++prefix;
+	}
+	size_t suffix = 0;
+	while (suffix < common - prefix && base[base.size() - 1 - suffix] == value[value.size() - 1 - suffix])
+	{
+		++suffix;
+	}
+	if (base.size() != value.size())
+	{
+		runs.push_back({prefix, base.size() - prefix - suffix, prefix, value.size() - prefix - suffix});
+		return runs;
+	}
+
+	// same size, e.g. a struct of fixed size fields: changed regions are replaced in place,
+	// those separated by less than a run header are merged
+	size_t copied = 0;
+	size_t i = prefix;
+	const size_t end = value.size() - suffix;
+	while (i < end)
+	{
+		size_t changed_end = i + 1;
+		size_t equal = 0;
+		for (size_t j = changed_end; j < end && equal < RUN_HEADER_SIZE; ++j)
+		{
+			if (base[j] == value[j])
+			{
+				++equal;
+			}
+			else
+			{
+				changed_end = j + 1;
+				equal = 0;
+			}
+		}
+		runs.push_back({i - copied, changed_end - i, i, changed_end - i});
+		copied = changed_end;
+		i = changed_end;
+		while (i < end && base[i] == value[i])
+		{
+			++i;
+		}
+	}
+	return runs;
+}
+}	 // namespace
+
+void DeltaCodec::write(Buffer& buffer, Buffer::ByteArray value)
+{
+	std::vector<run_t> runs;
+	bool patch = !resync.exchange(false);
+	if (patch)
+	{
+		runs = diff(sent, value);
+		size_t patch_size = PATCH_HEADER_SIZE;
+		for (auto const& run : runs)
+		{
+			patch_size += RUN_HEADER_SIZE + run.insert_size;
+		}
+		patch = patch_size < sizeof(int32_t) + value.size();
+	}
+
+	buffer.write_integral<uint8_t>(static_cast<uint8_t>(patch ? Kind::Patch : Kind::Whole));
+	if (patch)
+	{
+		buffer.write_integral<int64_t>(sent_hash);
+		buffer.write_integral<int32_t>(static_cast<int32_t>(runs.size()));
+		for (auto const& run : runs)
+		{
+			buffer.write_integral<int32_t>(static_cast<int32_t>(run.copy));
+			buffer.write_integral<int32_t>(static_cast<int32_t>(run.skip));
+			const Buffer::ByteArray insert(value.begin() + run.insert_from, value.begin() + run.insert_from + run.insert_size);
+			buffer.write_integral<int32_t>(static_cast<int32_t>(insert.size()));
+			buffer.write_byte_array_raw(insert);
+		}
+	}
+	else
+	{
+		buffer.write_integral<int32_t>(static_cast<int32_t>(value.size()));
+		buffer.write_byte_array_raw(value);
+	}
+
+	sent_hash = content_hash(value);
+	sent = std::move(value);
+}
+
+void DeltaCodec::write_whole_request(Buffer& buffer)
+{
+	awaiting_whole = true;
+	buffer.write_integral<uint8_t>(static_cast<uint8_t>(Kind::WholeRequest));
+}
+
+DeltaCodec::ReadResult DeltaCodec::read(Buffer& buffer, Buffer::ByteArray& value)
+{
+	const auto kind = static_cast<Kind>(buffer.read_integral<uint8_t>());
+	if (kind == Kind::WholeRequest)
+	{
+		reset();
+		return ReadResult::WholeRequested;
+	}
+
+	if (kind == Kind::Whole)
+	{
+		buffer.read_byte_array(received);
+		awaiting_whole = false;
+	}
+	else
+	{
+		const int64_t base_hash = buffer.read_integral<int64_t>();
+		const int32_t count = buffer.read_integral<int32_t>();
+		bool applicable = !awaiting_whole && base_hash == received_hash;
+		Buffer::ByteArray result;
+		result.reserve(received.size());
+		size_t position = 0;
+		Buffer::ByteArray insert;
+		for (int32_t i = 0; i < count; ++i)
+		{
+			const auto copy = static_cast<size_t>(buffer.read_integral<int32_t>());
+			const auto skip = static_cast<size_t>(buffer.read_integral<int32_t>());
+			buffer.read_byte_array(insert);
+			applicable = applicable && position + copy + skip <= received.size();
+			if (applicable)
+			{
+				result.insert(result.end(), received.begin() + position, received.begin() + position + copy);
+				result.insert(result.end(), insert.begin(), insert.end());
+				position += copy + skip;
+			}
+		}
+		if (!applicable)
+		{
+			// patches sent before the request arrived are made against the lost base too
+			return awaiting_whole ? ReadResult::Dropped : ReadResult::BaseMismatch;
+		}
+		result.insert(result.end(), received.begin() + position, received.end());
+		received = std::move(result);
+	}
+
+	received_hash = content_hash(received);
+	value = received;
+	return ReadResult::Value;
+}
+
+void DeltaCodec::reset()
+{
+	resync = true;
+}
+}	 // namespace rd
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef RD_CPP_DELTACODEC_H
+#define RD_CPP_DELTACODEC_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "protocol/Buffer.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+/**
+ * \brief Encodes consecutive serialized values of one entity as patches against the previous value.
+ *
+ * A patch carries only the changed regions: the bytes between the common prefix and suffix of the previous value,
+ * or each changed region separately if the size stays the same. Each direction has its own base and the
+ * receiving side replaces its base with every decoded value, rejected ones included, so both ends agree on it
+ * as long as messages are delivered in order. Patch carries a hash of its base to never be applied to another one.
+ * A side which lost its base asks the other one for the whole value with [write_whole_request]
+ * and drops patches until it arrives.
+ */
+class RD_FRAMEWORK_API DeltaCodec
+{
+	Buffer::ByteArray sent;
+	int64_t sent_hash = 0;
+
+	Buffer::ByteArray received;
+	int64_t received_hash = 0;
+
+	std::atomic_bool resync{true};
+
+	bool awaiting_whole = false;
+
+public:
+	enum class ReadResult
+	{
+		Value,
+		/**
+		 * \brief The patch was made against another base, the whole value has to be requested.
+		 */
+		BaseMismatch,
+		/**
+		 * \brief The patch came before the whole value which was requested already.
+		 */
+		Dropped,
+		/**
+		 * \brief The other side lost its base, the next written value goes whole and has to be written right away.
+		 */
+		WholeRequested
+	};
+
+	/**
+	 * \brief Writes [value] whole or as a patch against the previously written one, whichever is smaller.
+	 */
+	void write(Buffer& buffer, Buffer::ByteArray value);
+
+	/**
+	 * \brief Asks the other side to write its value whole, after [read] returned BaseMismatch.
+	 */
+	void write_whole_request(Buffer& buffer);
+
+	/**
+	 * \brief Reads a message written by [write] or [write_whole_request] on the other side.
+	 *
+	 * \return Value if [value] is set to the decoded value, it isn't changed otherwise
+	 */
+	ReadResult read(Buffer& buffer, Buffer::ByteArray& value);
+
+	/**
+	 * \brief Makes the next written value go whole, e.g. when the other side starts a new session and has no base.
+	 */
+	void reset();
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_DELTACODEC_H
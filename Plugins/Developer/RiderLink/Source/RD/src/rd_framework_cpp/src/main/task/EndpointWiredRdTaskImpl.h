@@ -0,0 +1,80 @@
+#ifndef RD_CPP_ENDPOINTWIREDRDTASKIMPL_H
+#define RD_CPP_ENDPOINTWIREDRDTASKIMPL_H
+
+#include "serialization/Polymorphic.h"
+#include "RdTask.h"
+#include "lifetime/LifetimeDefinition.h"
+#include "scheduler/SynchronousScheduler.h"
+
+#include <memory>
+
+namespace rd
+{
+namespace detail
+{
+/**
+ * \brief Endpoint side of a request which is being handled: listens to its cancellation by the caller.
+ *
+ * Handler works within [definition] which is terminated as soon as the caller sends an empty message to the task id
+ * or the endpoint is unbound. In both cases the task is cancelled without sending a response.
+ */
+template <typename T, typename S = Polymorphic<T>>
+class EndpointWiredRdTaskImpl final : public RdReactiveBase, public std::enable_shared_from_this<EndpointWiredRdTaskImpl<T, S>>
+{
+	RdReactiveBase const* cutpoint{};
+	/**
+	 * \brief Nested in bind lifetime of the endpoint.
+	 */
+	mutable LifetimeDefinition definition;
+
+public:
+	RdTask<T, S> task;
+
+	EndpointWiredRdTaskImpl(Lifetime lifetime, RdReactiveBase const& cutpoint, RdId rdid) : cutpoint(&cutpoint), definition(lifetime)
+	{
+		this->rdid = std::move(rdid);
+	}
+
+	Lifetime const& get_lifetime() const
+	{
+		return definition.lifetime;
+	}
+
+	/**
+	 * \brief Starts listening to cancellation of [task] which hasn't got a result yet.
+	 */
+	void listen() const
+	{
+		// listeners advised within [definition] are dead by now, so the cancellation isn't sent back as a response
+		definition.lifetime->add_action([task = task]() { task.set_result_if_empty(typename RdTaskResult<T, S>::Cancelled{}); });
+		cutpoint->get_wire()->advise(definition.lifetime, this);
+	}
+
+	/**
+	 * \brief Stops listening to cancellation and terminates the lifetime of the handler.
+	 */
+	void terminate() const
+	{
+		definition.terminate();
+	}
+
+	void on_wire_received(Buffer /*buffer*/) const override
+	{
+		RD_LOG_TRACE(logReceived, "endpoint {} {} received cancellation", to_string(cutpoint->location), to_string(rdid));
+		cutpoint->get_default_scheduler()->queue([weak = this->weak_from_this()]() {
+			if (auto self = weak.lock())
+			{
+				self->terminate();
+			}
+		});
+	}
+
+	IScheduler* get_wire_scheduler() const override
+	{
+		return &SynchronousScheduler::Instance();
+	}
+};
+}	 // namespace detail
+}	 // namespace rd
+
+#endif	  // RD_CPP_ENDPOINTWIREDRDTASKIMPL_H
@@ -7,7 +7,14 @@
 #include "scheduler/SynchronousScheduler.h"
 #include "WiredRdTask.h"
 
-#include <thread>
+#include <chrono>
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+#include "std/unordered_map.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -32,6 +39,20 @@ class RdCall : public virtual RdReactiveBase, public ISerializable
 
 	mutable optional<RdId> sync_task_id;
 
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+	using wired_task_impl_t = detail::WiredRdTaskImpl<TRes, ResSer>;
+
+	/**
+	 * \brief Tasks started by [start_batch] which haven't got a response yet, the batched response is delivered to the call itself.
+	 */
+	struct batched_t
+	{
+		std::mutex lock;
+		rd::unordered_map<RdId, std::weak_ptr<wired_task_impl_t>> tasks;
+	};
+	mutable std::unique_ptr<batched_t> batched{std::make_unique<batched_t>()};
+#endif
+
 public:
 	// region ctor/dtor
 	RdCall() = default;
@@ -61,6 +82,13 @@ public:
 		RdBindableBase::init(lifetime);
 		bind_lifetime = lifetime;
 		get_wire()->advise(lifetime, this);
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+		// tasks are cancelled by the termination on their own, nobody is going to answer them
+		lifetime->add_action([this]() {
+			std::lock_guard<decltype(batched->lock)> guard(batched->lock);
+			batched->tasks.clear();
+		});
+#endif
 	}
 
 	/**
@@ -72,16 +100,17 @@ public:
 	WiredRdTask<TRes, ResSer> sync(TReq const& request, std::chrono::milliseconds timeout = 200ms) const
 	{
 		auto task = start_internal(request, true, &SynchronousScheduler::Instance());
-		auto time_at_start = std::chrono::system_clock::now();
-		while (!task.has_value() && !(*bind_lifetime)->is_terminated() &&
-			   ((std::chrono::system_clock::now() - time_at_start) < timeout))
+		auto time_at_start = std::chrono::steady_clock::now();
+		// the response is set from the wire thread, termination of bind_lifetime cancels the task
+		if (!task.wait(timeout))
 		{
-			std::this_thread::yield();
+			// the endpoint may stop working on the request
+			task.set_result_if_empty(typename RdTaskResult<TRes, ResSer>::Cancelled{});
 		}
-		spdlog::debug("Time elapsed: {}, has_value={}", to_string(std::chrono::system_clock::now() - time_at_start),
-			to_string(task.has_value()));
-		task.value_or_throw().unwrap();	   // check for existing value
+		RD_LOG_DEBUG(logReceived, "call {}::{} SYNC finished in {}, has_value={}", to_string(location), to_string(rdid),
+			to_string(std::chrono::steady_clock::now() - time_at_start), to_string(task.has_value()));
 		sync_task_id = nullopt;
+		task.value_or_throw().unwrap();	   // check for existing value
 		return task;
 	}
 
@@ -102,13 +131,118 @@ public:
 		return start_internal(request, false, responseScheduler ? responseScheduler : get_default_scheduler());
 	}
 
+	/**
+	 * \brief @see start above, termination of [lifetime] cancels the task and the handling of [request] on the endpoint side.
+	 *
+	 * \param lifetime the result is needed within
+	 * \param request value of request
+	 * \param responseScheduler to assign value
+	 * \return task which will have its result value.
+	 */
+	WiredRdTask<TRes, ResSer> start(Lifetime lifetime, TReq const& request, IScheduler* responseScheduler = nullptr) const
+	{
+		return start_internal(request, false, responseScheduler ? responseScheduler : get_default_scheduler(), lifetime);
+	}
+
+	/**
+	 * \brief Coroutine-friendly [start]: `auto result = co_await call.start_async(request);`
+	 *
+	 * \param request value of request
+	 * \param responseScheduler to assign value and resume the awaiting coroutine on
+	 * \return awaitable of the task result
+	 */
+	RdTaskAwaiter<TRes, ResSer> start_async(TReq const& request, IScheduler* responseScheduler = nullptr) const
+	{
+		IScheduler* scheduler = responseScheduler ? responseScheduler : get_default_scheduler();
+		return start_internal(request, false, scheduler).resume_on(scheduler);
+	}
+
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+	/**
+	 * \brief Invokes the API once per element of [requests] sending all of them in a single message,
+	 * the endpoint answers the whole batch in a single message as well.
+	 *
+	 * \param requests values of requests
+	 * \param responseScheduler to assign values
+	 * \return tasks which will have their result values, in the order of [requests]
+	 */
+	std::vector<WiredRdTask<TRes, ResSer>> start_batch(std::vector<TReq> const& requests, IScheduler* responseScheduler = nullptr) const
+	{
+		assert_bound();
+		if (!async)
+		{
+			assert_threading();
+		}
+
+		IScheduler* scheduler = responseScheduler ? responseScheduler : get_default_scheduler();
+		std::vector<WiredRdTask<TRes, ResSer>> tasks;
+		std::vector<RdId> task_ids;
+		tasks.reserve(requests.size());
+		task_ids.reserve(requests.size());
+		for (size_t i = 0; i < requests.size(); ++i)
+		{
+			task_ids.push_back(get_protocol()->get_identity()->next(rdid));
+			tasks.emplace_back(*bind_lifetime, *this, task_ids.back(), scheduler);
+		}
+		{
+			// registered before sending, the response may come before the send returns.
+			// Not locked around the tasks' construction: the wire delivers the response holding its own lock.
+			std::lock_guard<decltype(batched->lock)> guard(batched->lock);
+			for (size_t i = 0; i < tasks.size(); ++i)
+			{
+				batched->tasks.emplace(task_ids[i], tasks[i].impl);
+			}
+		}
+
+		get_wire()->send(rdid, [&](Buffer& buffer) {
+			RD_LOG_TRACE(logSend, "call {}::{} send batch of {} requests", to_string(location), to_string(rdid), requests.size());
+			// a null task id tells the endpoint a batch follows
+			RdId::Null().write(buffer);
+			buffer.write_integral(static_cast<int32_t>(requests.size()));
+			for (size_t i = 0; i < requests.size(); ++i)
+			{
+				task_ids[i].write(buffer);
+				ReqSer::write(get_serialization_context(), buffer, requests[i]);
+			}
+		});
+
+		return tasks;
+	}
+#endif
+
 	void on_wire_received(Buffer buffer) const override
 	{
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+		// responses to single requests are sent to their task ids, only batched ones come to the call
+		const auto count = buffer.read_integral<int32_t>();
+		RD_LOG_TRACE(logReceived, "call {}::{} received batch of {} responses", to_string(location), to_string(rdid), count);
+		for (int32_t i = 0; i < count; ++i)
+		{
+			auto task_id = RdId::read(buffer);
+			auto result = RdTaskResult<TRes, ResSer>::read(get_serialization_context(), buffer);
+			std::shared_ptr<wired_task_impl_t> task;
+			{
+				std::lock_guard<decltype(batched->lock)> guard(batched->lock);
+				auto it = batched->tasks.find(task_id);
+				if (it != batched->tasks.end())
+				{
+					task = it->second.lock();
+					batched->tasks.erase(it);
+				}
+			}
+			if (task)
+			{
+				task->on_result_received(std::move(result));
+			}
+		}
+#else
 		RD_ASSERT_MSG(false, "RdCall.on_wire_received called")
+#endif
 	}
 
 private:
-	WiredRdTask<TRes, ResSer> start_internal(TReq const& request, bool sync, IScheduler* scheduler) const
+	WiredRdTask<TRes, ResSer> start_internal(
+		TReq const& request, bool sync, IScheduler* scheduler, optional<Lifetime> outer_lifetime = nullopt) const
 	{
 		assert_bound();
 		if (!async)
@@ -117,7 +251,12 @@ private:
 		}
 
 		RdId task_id = get_protocol()->get_identity()->next(rdid);
-		WiredRdTask<TRes, ResSer> task{*bind_lifetime, *this, task_id, scheduler};
+		WiredRdTask<TRes, ResSer> task{*bind_lifetime, outer_lifetime.value_or(*bind_lifetime), *this, task_id, scheduler};
+		if (task.has_value())
+		{
+			// cancelled right away, [outer_lifetime] has terminated already
+			return task;
+		}
 
 		if (sync)
 		{
@@ -130,7 +269,7 @@ private:
 		}
 
 		get_wire()->send(rdid, [&](Buffer& buffer) {
-			spdlog::get("logSend")->trace("call {}::{} send {} request {} : {}", to_string(location), to_string(rdid), (sync ? "SYNC" : "ASYNC"),
+			RD_LOG_TRACE(logSend, "call {}::{} send {} request {} : {}", to_string(location), to_string(rdid), (sync ? "SYNC" : "ASYNC"),
 				to_string(task_id), to_string(request));
 			task_id.write(buffer);
 			ReqSer::write(get_serialization_context(), buffer, request);
@@ -3,6 +3,12 @@
 
 #include "serialization/Polymorphic.h"
 #include "RdTask.h"
+#include "EndpointWiredRdTaskImpl.h"
+#include "std/unordered_map.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -27,8 +33,169 @@ class RdEndpoint : public virtual RdReactiveBase, public ISerializable
 
 	using handler_t = std::function<RdTask<TRes, ResSer>(Lifetime, TReq const&)>;
 	mutable handler_t local_handler;
+	/**
+	 * \brief Whether [local_handler] looks at its lifetime, plain functions complete synchronously and can't be cancelled.
+	 */
+	mutable bool cancellable = true;
+
+	using wired_task_t = detail::EndpointWiredRdTaskImpl<TRes, ResSer>;
+
+	/**
+	 * \brief Requests which haven't got a result yet, touched only on the wire scheduler.
+	 */
+	mutable rd::unordered_map<RdId, std::shared_ptr<wired_task_t>> awaiting_tasks;
+
+	/**
+	 * \brief Ids of [awaiting_tasks] which have been answered or cancelled, dropped on the next request.
+	 * Tasks can't be released right in their result listener: the listener is called while their property is firing.
+	 */
+	struct completed_t
+	{
+		std::mutex lock;
+		std::vector<RdId> ids;
+	};
+	mutable std::unique_ptr<completed_t> completed{std::make_unique<completed_t>()};
+
+	void forget_completed() const
+	{
+		std::vector<RdId> ids;
+		{
+			std::lock_guard<decltype(completed->lock)> guard(completed->lock);
+			ids.swap(completed->ids);
+		}
+		for (auto const& id : ids)
+		{
+			awaiting_tasks.erase(id);
+		}
+	}
+
+	RdTask<TRes, ResSer> invoke(Lifetime lifetime, TReq const& request) const
+	{
+		try
+		{
+			return local_handler(std::move(lifetime), request);
+		}
+		catch (std::exception const& e)
+		{
+			RdTask<TRes, ResSer> task;
+			task.fault(e);
+			return task;
+		}
+	}
+
+	void send_response(RdId const& task_id, RdTaskResult<TRes, ResSer> const& task_result) const
+	{
+		RD_LOG_TRACE(logSend, "endpoint {}::{} response = {}", to_string(location), to_string(rdid), to_string(task_result));
+		get_wire()->send(task_id, [&](Buffer& inner_buffer) { task_result.write(get_serialization_context(), inner_buffer); });
+	}
+
+	using respond_t = std::function<void(RdTaskResult<TRes, ResSer> const&)>;
+
+	/**
+	 * \brief Runs the handler for the request [task_id], [respond] is called with its result.
+	 * A request cancelled by the caller isn't answered unless [answer_cancellation] is set.
+	 */
+	void handle(RdId const& task_id, TReq const& request, respond_t respond, bool answer_cancellation) const
+	{
+		if (!cancellable)
+		{
+			respond(invoke(*bind_lifetime, request).value_or_throw());
+			return;
+		}
+
+		// handler works within the request's own lifetime, the caller may cancel it by sending a message to [task_id]
+		auto wired_task = std::make_shared<wired_task_t>(*bind_lifetime, *this, task_id);
+		RdTask<TRes, ResSer> task = invoke(wired_task->get_lifetime(), request);
+		if (task.has_value())
+		{
+			// answered synchronously, nothing to keep
+			respond(task.value_or_throw());
+			return;
+		}
+
+		wired_task->task = task;
+		wired_task->get_lifetime()->add_action([this, task_id]() {
+			std::lock_guard<decltype(completed->lock)> guard(completed->lock);
+			completed->ids.push_back(task_id);
+		});
+		wired_task->listen();
+		if (answer_cancellation)
+		{
+			// runs after a normal response too, [respond] has to ignore the second call
+			wired_task->get_lifetime()->add_action([respond]() { respond(typename RdTaskResult<TRes, ResSer>::Cancelled{}); });
+		}
+		awaiting_tasks.emplace(task_id, wired_task);
+		task.advise(wired_task->get_lifetime(),
+			[respond = std::move(respond), wired_task = wired_task.get()](RdTaskResult<TRes, ResSer> const& task_result) {
+				respond(task_result);
+				wired_task->terminate();
+			});
+	}
+
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+	/**
+	 * \brief Results of a batch of requests, answered in one message to the call once the last of them is known.
+	 */
+	struct batch_t
+	{
+		std::mutex lock;
+		std::vector<std::pair<RdId, optional<RdTaskResult<TRes, ResSer>>>> results;
+		size_t pending = 0;
+	};
+
+	void on_batch_received(Buffer& buffer) const
+	{
+		const auto count = buffer.read_integral<int32_t>();
+		RD_LOG_TRACE(logReceived, "endpoint {}::{} received batch of {} requests", to_string(location), to_string(rdid), count);
+		auto batch = std::make_shared<batch_t>();
+		batch->results.resize(count);
+		batch->pending = count;
+		for (int32_t i = 0; i < count; ++i)
+		{
+			auto task_id = RdId::read(buffer);
+			auto value = ReqSer::read(get_serialization_context(), buffer);
+			batch->results[i].first = task_id;
+			handle(
+				task_id, wrapper::get<TReq>(value),
+				[this, batch, i](RdTaskResult<TRes, ResSer> const& task_result) {
+					{
+						std::lock_guard<decltype(batch->lock)> guard(batch->lock);
+						auto& slot = batch->results[i].second;
+						if (slot.has_value())
+						{
+							return;
+						}
+						slot.emplace(task_result);
+						if (--batch->pending > 0)
+						{
+							return;
+						}
+					}
+					send_batch_response(*batch);
+				},
+				true);
+		}
+	}
+
+	void send_batch_response(batch_t const& batch) const
+	{
+		if ((*bind_lifetime)->is_terminated())
+		{
+			// the rest of the batch was cancelled by unbinding of the endpoint
+			return;
+		}
+		RD_LOG_TRACE(logSend, "endpoint {}::{} batch of {} responses", to_string(location), to_string(rdid), batch.results.size());
+		get_wire()->send(rdid, [&](Buffer& buffer) {
+			buffer.write_integral(static_cast<int32_t>(batch.results.size()));
+			for (auto const& result : batch.results)
+			{
+				result.first.write(buffer);
+				result.second->write(get_serialization_context(), buffer);
+			}
+		});
+	}
+#endif
 
-	mutable tsl::ordered_map<RdId, RdTask<TRes, ResSer>, rd::hash<RdId>> awaiting_tasks;	// TO-DO get rid of it
 public:
 	// region ctor/dtor
 
@@ -75,6 +242,7 @@ public:
 	{
 		RD_ASSERT_MSG(handler, "handler is set already");
 		local_handler = std::move(handler);
+		cancellable = true;
 	}
 
 	/**
@@ -85,6 +253,7 @@ public:
 		local_handler = [handler = std::move(functor)](Lifetime _, TReq const& req) -> RdTask<TRes, ResSer> {
 			return RdTask<TRes, ResSer>::from_result(handler(req));
 		};
+		cancellable = false;
 	}
 
 	void init(Lifetime lifetime) const override
@@ -92,31 +261,35 @@ public:
 		RdReactiveBase::init(lifetime);
 		bind_lifetime = lifetime;
 		get_wire()->advise(lifetime, this);
+		// listeners of pending tasks die with the lifetime, nobody is going to answer them
+		lifetime->add_action([this]() {
+			awaiting_tasks.clear();
+			std::lock_guard<decltype(completed->lock)> guard(completed->lock);
+			completed->ids.clear();
+		});
 	}
 
 	void on_wire_received(Buffer buffer) const override
 	{
-		auto task_id = RdId::read(buffer);
-		auto value = ReqSer::read(get_serialization_context(), buffer);
-		spdlog::get("logReceived")->trace("endpoint {}::{} request = {}", to_string(location), to_string(rdid), to_string(value));
 		if (!local_handler)
 		{
 			throw std::invalid_argument("handler is empty for RdEndPoint");
 		}
-		auto task = awaiting_tasks[task_id] = {};
-		try
-		{
-			task = local_handler(*bind_lifetime, wrapper::get<TReq>(value));
-		}
-		catch (std::exception const& e)
+		forget_completed();
+
+		auto task_id = RdId::read(buffer);
+#if defined(RD_BATCH_CALLS) && RD_BATCH_CALLS == 1
+		if (task_id.isNull())
 		{
-			task.fault(e);
+			on_batch_received(buffer);
+			return;
 		}
-		task.advise(*bind_lifetime, [this, task_id, &task](RdTaskResult<TRes, ResSer> const& task_result) {
-			spdlog::get("logSend")->trace("endpoint {}::{} response = {}", to_string(location), to_string(rdid), to_string(*task.result));
-			get_wire()->send(task_id, [&](Buffer& inner_buffer) { task_result.write(get_serialization_context(), inner_buffer); });
-			// TO-DO remove from awaiting_tasks
-		});
+#endif
+		auto value = ReqSer::read(get_serialization_context(), buffer);
+		RD_LOG_TRACE(logReceived, "endpoint {}::{} request = {}", to_string(location), to_string(rdid), to_string(value));
+		handle(
+			task_id, wrapper::get<TReq>(value),
+			[this, task_id](RdTaskResult<TRes, ResSer> const& task_result) { send_response(task_id, task_result); }, false);
 	}
 
 	friend bool operator==(const RdEndpoint& lhs, const RdEndpoint& rhs)
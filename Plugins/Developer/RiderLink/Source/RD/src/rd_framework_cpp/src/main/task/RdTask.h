@@ -2,6 +2,7 @@
 #define RD_CPP_RDTASK_H
 
 #include "RdTaskImpl.h"
+#include "RdTaskAwaiter.h"
 #include "serialization/Polymorphic.h"
 
 #include <functional>
@@ -84,6 +85,16 @@ public:
 		return impl->result.has_value();
 	}
 
+	/**
+	 * \brief Blocks the calling thread without spinning until the task has a result or [timeout] expires.
+	 *
+	 * \return true if the task has a result
+	 */
+	bool wait(std::chrono::milliseconds timeout) const
+	{
+		return impl->wait(timeout);
+	}
+
 	const TRes& value_or_throw() const
 	{
 		if (impl->result.has_value())
@@ -111,6 +122,16 @@ public:
 		return has_value() && value_or_throw().is_faulted();	// TO-DO atomic
 	}
 
+	/**
+	 * \brief Awaitable which resumes the coroutine on [scheduler] once the task has a result.
+	 *
+	 * \param scheduler to resume on
+	 */
+	RdTaskAwaiter<T, S> resume_on(IScheduler* scheduler) const
+	{
+		return RdTaskAwaiter<T, S>(impl, scheduler);
+	}
+
 	void advise(Lifetime lifetime, std::function<void(TRes const&)> handler) const
 	{
 		impl->result.advise(lifetime, [handler = std::move(handler)](optional<TRes> const& opt_value) {
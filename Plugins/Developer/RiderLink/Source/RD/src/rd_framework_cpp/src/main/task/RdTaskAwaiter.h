@@ -0,0 +1,68 @@
+#ifndef RD_CPP_RDTASKAWAITER_H
+#define RD_CPP_RDTASKAWAITER_H
+
+#include "RdTaskImpl.h"
+#include "scheduler/base/IScheduler.h"
+#include "util/core_util.h"
+
+#include <memory>
+
+namespace rd
+{
+/**
+ * \brief Awaitable view of \link rd::RdTask for coroutines: `auto result = co_await task.resume_on(scheduler);`
+ *
+ * Coroutine handle type is a template parameter, so the header doesn't require C++20 itself.
+ * The coroutine is resumed by a separate action queued on [scheduler] once the task has a result:
+ * resuming right from the result's listener could release the task while its property is still firing.
+ * Resumed coroutine gets \link rd::RdTaskResult, which may be Cancelled or Fault.
+ *
+ * \tparam T type of stored value
+ * \tparam S "SerDes" for value
+ */
+template <typename T, typename S>
+class RdTaskAwaiter
+{
+	std::shared_ptr<detail::RdTaskImpl<T, S>> impl;
+	IScheduler* scheduler;
+	/**
+	 * \brief Whatever has to stay alive to deliver the result, e.g. subscription of \link rd::WiredRdTask to the wire.
+	 */
+	std::shared_ptr<void const> keep_alive;
+
+public:
+	// region ctor/dtor
+	RdTaskAwaiter(
+		std::shared_ptr<detail::RdTaskImpl<T, S>> impl, IScheduler* scheduler, std::shared_ptr<void const> keep_alive = nullptr)
+		: impl(std::move(impl)), scheduler(scheduler), keep_alive(std::move(keep_alive))
+	{
+		RD_ASSERT_MSG(this->scheduler != nullptr, "scheduler to resume on must be specified");
+	}
+	// endregion
+
+	bool await_ready() const
+	{
+		return impl->is_completed() && scheduler->is_active();
+	}
+
+	template <typename Handle>
+	bool await_suspend(Handle handle)
+	{
+		IScheduler* resume_scheduler = scheduler;
+		auto resume = [resume_scheduler, handle]() { resume_scheduler->queue([handle]() mutable { handle.resume(); }); };
+		if (!impl->on_completed(resume))
+		{
+			// completed between await_ready and here
+			resume();
+		}
+		return true;
+	}
+
+	RdTaskResult<T, S> await_resume() const
+	{
+		return impl->result.get();
+	}
+};
+}	 // namespace rd
+
+#endif	  // RD_CPP_RDTASKAWAITER_H
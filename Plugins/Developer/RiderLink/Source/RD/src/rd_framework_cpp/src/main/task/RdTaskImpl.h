@@ -6,11 +6,19 @@
 
 #include "thirdparty.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 namespace rd
 {
 template <typename, typename>
 class RdTask;
 
+template <typename, typename>
+class RdTaskAwaiter;
+
 namespace detail
 {
 template <typename T, typename S = Polymorphic<T>>
@@ -19,9 +27,79 @@ class RdTaskImpl
 private:
 	mutable Property<RdTaskResult<T, S>> result;
 
+	// region completion
+	mutable std::mutex completion_lock;
+	mutable std::condition_variable completion_cv;
+	mutable bool completed = false;
+	mutable std::vector<std::function<void()>> continuations;
+	// endregion
+
+	/**
+	 * \brief Blocks the calling thread until [result] is set or [timeout] expires.
+	 *
+	 * \return true if result was set
+	 */
+	bool wait(std::chrono::milliseconds timeout) const
+	{
+		std::unique_lock<decltype(completion_lock)> ul(completion_lock);
+		return completion_cv.wait_for(ul, timeout, [this]() -> bool { return completed; });
+	}
+
+	bool is_completed() const
+	{
+		std::lock_guard<decltype(completion_lock)> guard(completion_lock);
+		return completed;
+	}
+
+	/**
+	 * \brief Registers [continuation] to be invoked on the thread which sets [result].
+	 *
+	 * \return false if result is set already, [continuation] isn't stored in this case
+	 */
+	bool on_completed(std::function<void()> continuation) const
+	{
+		std::lock_guard<decltype(completion_lock)> guard(completion_lock);
+		if (completed)
+		{
+			return false;
+		}
+		continuations.push_back(std::move(continuation));
+		return true;
+	}
+
+	void complete() const
+	{
+		std::vector<std::function<void()>> ready;
+		{
+			std::lock_guard<decltype(completion_lock)> guard(completion_lock);
+			completed = true;
+			completion_cv.notify_all();
+			ready.swap(continuations);
+		}
+		for (auto const& continuation : ready)
+		{
+			continuation();
+		}
+	}
+
 public:
 	template <typename, typename>
 	friend class ::rd::RdTask;
+
+	template <typename, typename>
+	friend class ::rd::RdTaskAwaiter;
+
+	// region ctor/dtor
+	RdTaskImpl()
+	{
+		// result may be set on any thread (wire, response scheduler, lifetime termination), so waiters are woken from here
+		result.advise(Lifetime::Eternal(), [this](RdTaskResult<T, S> const&) { complete(); });
+	}
+
+	RdTaskImpl(RdTaskImpl const&) = delete;
+
+	RdTaskImpl& operator=(RdTaskImpl const&) = delete;
+	// endregion
 };
 }	 // namespace detail
 }	 // namespace rd
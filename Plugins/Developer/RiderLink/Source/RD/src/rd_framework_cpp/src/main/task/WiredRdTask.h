@@ -14,11 +14,24 @@ class WiredRdTask final : public RdTask<T, S>
 	mutable std::shared_ptr<detail::WiredRdTaskImpl<T, S>> impl{};
 
 public:
+	template <typename, typename, typename, typename>
+	friend class RdCall;
+
 	// region ctor/dtor
 	WiredRdTask() = delete;
 
 	WiredRdTask(Lifetime lifetime, RdReactiveBase const& call, RdId rdid, IScheduler* scheduler)
-		: impl(std::make_shared<detail::WiredRdTaskImpl<T, S>>(lifetime, call, rdid, scheduler, RdTask<T, S>::result))
+		: WiredRdTask(lifetime, lifetime, call, std::move(rdid), scheduler)
+	{
+	}
+
+	/**
+	 * \param lifetime bind lifetime of [call]
+	 * \param outer_lifetime termination cancels the task and the request on the endpoint side
+	 */
+	WiredRdTask(Lifetime lifetime, Lifetime outer_lifetime, RdReactiveBase const& call, RdId rdid, IScheduler* scheduler)
+		: impl(std::make_shared<detail::WiredRdTaskImpl<T, S>>(
+			  lifetime, outer_lifetime, call, std::move(rdid), scheduler, RdTask<T, S>::impl, RdTask<T, S>::result))
 	{
 	}
 
@@ -32,6 +45,24 @@ public:
 
 	virtual ~WiredRdTask() = default;
 	// endregion
+
+	/**
+	 * \brief @see RdTask::resume_on, the awaiter also keeps this task subscribed to the response.
+	 */
+	RdTaskAwaiter<T, S> resume_on(IScheduler* scheduler) const
+	{
+		return RdTaskAwaiter<T, S>(RdTask<T, S>::impl, scheduler, impl);
+	}
+
+#if defined(__cpp_impl_coroutine)
+	/**
+	 * \brief Resumes on the scheduler the response is delivered to.
+	 */
+	RdTaskAwaiter<T, S> operator co_await() const
+	{
+		return resume_on(impl->scheduler);
+	}
+#endif
 };
 }	 // namespace rd
 
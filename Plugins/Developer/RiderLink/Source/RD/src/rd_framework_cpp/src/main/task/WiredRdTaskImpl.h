@@ -2,7 +2,11 @@
 #define RD_CPP_WIREDRDTASKIMPL_H
 
 #include "serialization/Polymorphic.h"
+#include "RdTaskImpl.h"
 #include "RdTaskResult.h"
+#include "lifetime/LifetimeDefinition.h"
+
+#include <memory>
 
 namespace rd
 {
@@ -12,44 +16,107 @@ class WiredRdTask;
 namespace detail
 {
 template <typename T, typename S = Polymorphic<T>>
-class WiredRdTaskImpl : public RdReactiveBase
+class WiredRdTaskImpl : public RdReactiveBase, public std::enable_shared_from_this<WiredRdTaskImpl<T, S>>
 {
 private:
 	Lifetime lifetime;
+	/**
+	 * \brief Lifetime the caller is interested in the result within, the task is cancelled on its termination too.
+	 */
+	Lifetime outer_lifetime;
+	/**
+	 * \brief Nested in [lifetime], keeps this task subscribed to the wire until the response is received.
+	 */
+	mutable LifetimeDefinition subscription_definition;
 	RdReactiveBase const* cutpoint{};
 	IScheduler* scheduler{};
+	/**
+	 * \brief Owns [result], a response being delivered keeps both alive after the caller has dropped the task.
+	 */
+	std::shared_ptr<RdTaskImpl<T, S>> task;
 	Property<RdTaskResult<T, S>>* result{};
 
-	LifetimeImpl::counter_t termination_lifetime_id{};
+	LifetimeImpl::action_id_t termination_lifetime_id{-1};
+	LifetimeImpl::action_id_t outer_termination_lifetime_id{-1};
+
+	/**
+	 * \brief Tells the endpoint it may stop handling the request: an empty message to the task id.
+	 */
+	void send_cancellation() const
+	{
+		RD_LOG_TRACE(logSend, "call {} {} send cancellation", to_string(cutpoint->location), to_string(rdid));
+		cutpoint->get_wire()->send(rdid, [](Buffer&) {});
+	}
 
 public:
 	template <typename, typename>
 	friend class ::rd::WiredRdTask;
 
-	WiredRdTaskImpl(
-		Lifetime lifetime, RdReactiveBase const& cutpoint, RdId rdid, IScheduler* scheduler, Property<RdTaskResult<T, S>>* result)
-		: lifetime(lifetime), cutpoint(&cutpoint), scheduler(scheduler), result(result)
+	WiredRdTaskImpl(Lifetime lifetime, Lifetime outer_lifetime, RdReactiveBase const& cutpoint, RdId rdid, IScheduler* scheduler,
+		std::shared_ptr<RdTaskImpl<T, S>> task, Property<RdTaskResult<T, S>>* result)
+		: lifetime(lifetime)
+		, outer_lifetime(outer_lifetime)
+		, subscription_definition(lifetime)
+		, cutpoint(&cutpoint)
+		, scheduler(scheduler)
+		, task(std::move(task))
+		, result(result)
 	{
 		this->rdid = std::move(rdid);
-		cutpoint.get_wire()->advise(lifetime, this);
+		if (outer_lifetime->is_terminated())
+		{
+			// nobody is interested in the result, the request isn't going to be sent
+			subscription_definition.terminate();
+			result->set(typename RdTaskResult<T, S>::Cancelled{});
+			return;
+		}
+		cutpoint.get_wire()->advise(subscription_definition.lifetime, this);
+		// the result is cancelled locally before the response came, the endpoint doesn't need to finish the request
+		result->advise(subscription_definition.lifetime, [this](optional<RdTaskResult<T, S>> const& value) {
+			if (value && value->is_canceled())
+			{
+				send_cancellation();
+				subscription_definition.terminate();
+			}
+		});
 		termination_lifetime_id =
 			lifetime->add_action([this]() { this->result->set_if_empty(typename RdTaskResult<T, S>::Cancelled{}); });
+		if (outer_lifetime != lifetime)
+		{
+			outer_termination_lifetime_id =
+				outer_lifetime->add_action([this]() { this->result->set_if_empty(typename RdTaskResult<T, S>::Cancelled{}); });
+		}
 	}
 
 	virtual ~WiredRdTaskImpl()
 	{
 		lifetime->remove_action(termination_lifetime_id);
+		if (outer_termination_lifetime_id != -1)
+		{
+			outer_lifetime->remove_action(outer_termination_lifetime_id);
+		}
 	}
 
 	void on_wire_received(Buffer buffer) const override
 	{
 		auto read_result = RdTaskResult<T, S>::read(cutpoint->get_serialization_context(), buffer);
-		spdlog::get("logReceived")->trace("call {} {} received response {} : {}", to_string(cutpoint->location), to_string(rdid), to_string(rdid),
+		RD_LOG_TRACE(logReceived, "call {} {} received response {} : {}", to_string(cutpoint->location), to_string(rdid), to_string(rdid),
 			to_string(read_result));
-		scheduler->queue([&, result = std::move(read_result)]() mutable {
+		on_result_received(std::move(read_result));
+	}
+
+	/**
+	 * \brief Delivers the response to [scheduler], the one read from the wire or from a batched response of the call.
+	 * The task is kept alive until then, the caller may drop it meanwhile.
+	 */
+	void on_result_received(RdTaskResult<T, S> read_result) const
+	{
+		scheduler->queue([&, self = this->shared_from_this(), result = std::move(read_result)]() mutable {
+			// there is exactly one response per task id, it mustn't be answered by a cancellation either
+			subscription_definition.terminate();
 			if (this->result->has_value())
 			{
-				spdlog::get("logReceived")->trace("call {} {} response was dropped, task result is: {}", to_string(location), to_string(rdid),
+				RD_LOG_TRACE(logReceived, "call {} {} response was dropped, task result is: {}", to_string(location), to_string(rdid),
 					to_string(result.unwrap()));
 			}
 			else
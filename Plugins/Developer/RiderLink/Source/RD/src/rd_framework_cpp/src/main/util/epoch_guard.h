@@ -0,0 +1,85 @@
+#ifndef RD_CPP_EPOCH_GUARD_H
+#define RD_CPP_EPOCH_GUARD_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace rd
+{
+namespace util
+{
+/**
+ * \brief Lets a single writer wait for the readers which could still see an object it has just unpublished.
+ *
+ * Readers register in the bucket of the current epoch for as long as they use the object.
+ * [synchronize] flips the epoch and waits only for the bucket of the finished one,
+ * so new readers never wait for the writer and can't keep it waiting either.
+ */
+class epoch_guard
+{
+	std::atomic_uint32_t epoch{0};
+
+	mutable std::atomic_int32_t readers[2] = {{0}, {0}};
+
+public:
+	/**
+	 * \brief Counts the reader in for its scope.
+	 */
+	class read_section
+	{
+		epoch_guard const& owner;
+		uint32_t bucket;
+
+	public:
+		explicit read_section(epoch_guard const& owner) : owner(owner)
+		{
+			while (true)
+			{
+				const uint32_t current = owner.epoch.load();
+				bucket = current & 1;
+				++owner.readers[bucket];
+				// a reader counted in the bucket of a finished epoch could see the next unpublished object unnoticed
+				if (owner.epoch.load() == current)
+				{
+					return;
+				}
+				owner.readers[bucket].fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		read_section(read_section const&) = delete;
+
+		read_section& operator=(read_section const&) = delete;
+
+		~read_section()
+		{
+			owner.readers[bucket].fetch_sub(1, std::memory_order_release);
+		}
+	};
+
+	/**
+	 * \brief Writer only, waits for the readers which started before the call.
+	 * Whatever was unpublished before it may be freed once it returns.
+	 */
+	void synchronize()
+	{
+		const uint32_t bucket = epoch.fetch_add(1) & 1;
+		while (readers[bucket].load() != 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	/**
+	 * \brief No reader is in flight, nobody can hold anything unpublished before the call.
+	 */
+	bool is_idle() const
+	{
+		return readers[0].load() == 0 && readers[1].load() == 0;
+	}
+};
+}	 // namespace util
+}	 // namespace rd
+
+#endif	  // RD_CPP_EPOCH_GUARD_H
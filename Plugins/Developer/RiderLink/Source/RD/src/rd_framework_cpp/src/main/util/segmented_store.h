@@ -0,0 +1,158 @@
+#ifndef RD_CPP_SEGMENTED_STORE_H
+#define RD_CPP_SEGMENTED_STORE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace rd
+{
+namespace util
+{
+/**
+ * \brief Index-addressed store which never moves its elements.
+ *
+ * Storage is a fixed table of segments, each twice as large as the previous one, so growing never reallocates
+ * what readers may be looking at. Reads are lock-free; [set] and [clear] must be serialized by the caller,
+ * and [clear] mustn't race with readers.
+ */
+template <typename T, size_t FirstSegmentSize = 64>
+class segmented_store
+{
+	static_assert((FirstSegmentSize & (FirstSegmentSize - 1)) == 0, "first segment size must be a power of two");
+
+	static constexpr size_t SEGMENTS_COUNT = 24;
+
+	struct slot
+	{
+		std::atomic<bool> ready{false};
+		alignas(T) unsigned char storage[sizeof(T)];
+
+		T* get()
+		{
+			return reinterpret_cast<T*>(&storage);
+		}
+	};
+
+	std::array<std::atomic<slot*>, SEGMENTS_COUNT> segments{};
+
+	static size_t segment_size(size_t segment)
+	{
+		return FirstSegmentSize << segment;
+	}
+
+	static std::pair<size_t, size_t> locate(size_t index)
+	{
+		size_t segment = 0;
+		for (size_t v = index / FirstSegmentSize + 1; v > 1; v >>= 1)
+		{
+			++segment;
+		}
+		return {segment, index - FirstSegmentSize * ((size_t(1) << segment) - 1)};
+	}
+
+	slot* find_slot(size_t index) const
+	{
+		const auto location = locate(index);
+		if (location.first >= SEGMENTS_COUNT)
+		{
+			return nullptr;
+		}
+		slot* segment = segments[location.first].load(std::memory_order_acquire);
+		return segment == nullptr ? nullptr : segment + location.second;
+	}
+
+public:
+	// region ctor/dtor
+
+	segmented_store()
+	{
+		segments[0].store(new slot[segment_size(0)], std::memory_order_release);
+	}
+
+	segmented_store(segmented_store const&) = delete;
+
+	segmented_store& operator=(segmented_store const&) = delete;
+
+	~segmented_store()
+	{
+		clear();
+		delete[] segments[0].load();
+	}
+	// endregion
+
+	/**
+	 * \return pointer to the element stored at [index] or nullptr if it hasn't been set yet.
+	 */
+	T const* get(size_t index) const
+	{
+		slot* s = find_slot(index);
+		if (s == nullptr || !s->ready.load(std::memory_order_acquire))
+		{
+			return nullptr;
+		}
+		return s->get();
+	}
+
+	/**
+	 * \brief Stores [value] at [index] unless something is already there.
+	 * A stored element is never replaced since readers may be using it, callers should treat a refused set as a bug.
+	 * \return whether the value was stored.
+	 */
+	bool set(size_t index, T value)
+	{
+		const auto location = locate(index);
+		if (location.first >= SEGMENTS_COUNT)
+		{
+			return false;
+		}
+		slot* segment = segments[location.first].load(std::memory_order_relaxed);
+		if (segment == nullptr)
+		{
+			segment = new slot[segment_size(location.first)];
+			segments[location.first].store(segment, std::memory_order_release);
+		}
+		slot& s = segment[location.second];
+		if (s.ready.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+		new (s.get()) T(std::move(value));
+		s.ready.store(true, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * \brief Destroys all elements, keeping the first segment allocated.
+	 */
+	void clear()
+	{
+		for (size_t i = 0; i < SEGMENTS_COUNT; ++i)
+		{
+			slot* segment = segments[i].load();
+			if (segment == nullptr)
+			{
+				continue;
+			}
+			for (size_t j = 0; j < segment_size(i); ++j)
+			{
+				if (segment[j].ready.load())
+				{
+					segment[j].get()->~T();
+					segment[j].ready.store(false);
+				}
+			}
+			if (i > 0)
+			{
+				segments[i].store(nullptr);
+				delete[] segment;
+			}
+		}
+	}
+};
+}	 // namespace util
+}	 // namespace rd
+
+#endif	  // RD_CPP_SEGMENTED_STORE_H
@@ -0,0 +1,75 @@
+#ifndef RD_CPP_STRIPED_MAP_H
+#define RD_CPP_STRIPED_MAP_H
+
+#include "std/unordered_map.h"
+
+#include "thirdparty.hpp"
+
+#include <array>
+#include <mutex>
+
+namespace rd
+{
+namespace util
+{
+/**
+ * \brief Hash map split into independently locked stripes, so concurrent lookups of different keys rarely contend.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, size_t StripesCount = 16>
+class striped_map
+{
+	struct stripe
+	{
+		mutable std::mutex lock;
+		rd::unordered_map<K, V, Hash, KeyEqual> map;
+	};
+
+	std::array<stripe, StripesCount> stripes;
+
+	stripe& stripe_of(K const& key)
+	{
+		return stripes[Hash()(key) % StripesCount];
+	}
+
+	stripe const& stripe_of(K const& key) const
+	{
+		return stripes[Hash()(key) % StripesCount];
+	}
+
+public:
+	optional<V> find(K const& key) const
+	{
+		stripe const& s = stripe_of(key);
+		std::lock_guard<std::mutex> guard(s.lock);
+		auto it = s.map.find(key);
+		if (it == s.map.end())
+		{
+			return nullopt;
+		}
+		return it->second;
+	}
+
+	/**
+	 * \brief Inserts [value] for [key] unless [key] is already present.
+	 * \return whether the value was inserted.
+	 */
+	bool insert(K const& key, V value)
+	{
+		stripe& s = stripe_of(key);
+		std::lock_guard<std::mutex> guard(s.lock);
+		return s.map.emplace(key, std::move(value)).second;
+	}
+
+	void clear()
+	{
+		for (auto& s : stripes)
+		{
+			std::lock_guard<std::mutex> guard(s.lock);
+			s.map.clear();
+		}
+	}
+};
+}	 // namespace util
+}	 // namespace rd
+
+#endif	  // RD_CPP_STRIPED_MAP_H
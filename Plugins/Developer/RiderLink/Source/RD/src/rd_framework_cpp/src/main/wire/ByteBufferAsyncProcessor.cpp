@@ -12,8 +12,7 @@ size_t ByteBufferAsyncProcessor::INITIAL_CAPACITY = 1024 * 1024;
 std::shared_ptr<spdlog::logger> ByteBufferAsyncProcessor::logger =
 	spdlog::stderr_color_mt<spdlog::synchronous_factory>("byteBufferLog", spdlog::color_mode::automatic);
 
-ByteBufferAsyncProcessor::ByteBufferAsyncProcessor(
-	std::string id, std::function<bool(Buffer::ByteArray const&, sequence_number_t)> processor)
+ByteBufferAsyncProcessor::ByteBufferAsyncProcessor(std::string id, processor_t processor)
 	: id(std::move(id)), processor(std::move(processor))
 {
 	data.reserve(INITIAL_CAPACITY);
@@ -37,14 +36,14 @@ bool ByteBufferAsyncProcessor::terminate0(time_t timeout, StateKind state_to_set
 		std::lock_guard<decltype(lock)> guard(lock);
 		if (state == StateKind::Initialized)
 		{
-			logger->debug("Can't {} \'{}\', because it hasn't been started yet", std::string(action), id);
+			RD_LOG_DEBUG(logger, "Can't {} \'{}\', because it hasn't been started yet", std::string(action), id);
 			cleanup0();
 			return true;
 		}
 
 		if (state >= state_to_set)
 		{
-			logger->debug("Trying to {} async processor \'{}' but it's in state {}", std::string(action), id, to_string(state));
+			RD_LOG_DEBUG(logger, "Trying to {} async processor \'{}' but it's in state {}", std::string(action), id, to_string(state));
 			return true;
 		}
 
@@ -67,7 +66,7 @@ bool ByteBufferAsyncProcessor::terminate0(time_t timeout, StateKind state_to_set
 	return success;
 }
 
-void ByteBufferAsyncProcessor::add_data(std::vector<Buffer::ByteArray>&& new_data)
+void ByteBufferAsyncProcessor::add_data(std::vector<Package>&& new_data)
 {
 	std::lock_guard<decltype(queue_lock)> guard(queue_lock);
 	std::move(new_data.begin(), new_data.end(), std::back_inserter(queue));
@@ -81,14 +80,14 @@ bool ByteBufferAsyncProcessor::reprocess()
 	{
 		std::lock_guard<decltype(queue_lock)> guard(queue_lock);
 
-		logger->debug("{}: reprocessing started", id);
+		RD_LOG_DEBUG(logger, "{}: reprocessing started", id);
 
 		std::unique_lock<decltype(processing_lock)> ul(processing_lock);
 		processing_cv.wait(ul, [this]() -> bool { return !in_processing; });
 
-		logger->debug("{}: reprocessing waited for main processing", id);
+		RD_LOG_DEBUG(logger, "{}: reprocessing waited for main processing", id);
 
-		while (current_seqn <= acknowledged_seqn)
+		while (current_seqn <= acknowledged_seqn && !pending_queue.empty())
 		{
 			pending_queue.pop_front();
 			++current_seqn;
@@ -112,7 +111,7 @@ void ByteBufferAsyncProcessor::process()
 		std::unique_lock<decltype(processing_lock)> ul(processing_lock);
 		util::bool_guard bool_guard(in_processing);
 
-		logger->debug("{}: processing started", id);
+		RD_LOG_DEBUG(logger, "{}: processing started", id);
 
 		while (!queue.empty() && processor(queue.front(), max_sent_seqn + 1))
 		{
@@ -149,7 +148,7 @@ void ByteBufferAsyncProcessor::ThreadProc()
 				}
 				cv.wait(lock);
 
-				logger->debug("{}'s ThreadProc waited for notify", id);
+				RD_LOG_DEBUG(logger, "{}'s ThreadProc waited for notify", id);
 
 				if (state >= StateKind::Terminating)
 				{
@@ -178,7 +177,7 @@ void ByteBufferAsyncProcessor::start()
 
 		if (state != StateKind::Initialized)
 		{
-			logger->debug("Trying to START async processor {} but it's in state {}", id, to_string(state));
+			RD_LOG_DEBUG(logger, "Trying to START async processor {} but it's in state {}", id, to_string(state));
 			return;
 		}
 
@@ -200,6 +199,7 @@ bool ByteBufferAsyncProcessor::terminate(time_t timeout)
 
 void ByteBufferAsyncProcessor::put(Buffer::ByteArray new_data)
 {
+	const auto now = std::chrono::steady_clock::now();
 	{
 		std::lock_guard<decltype(lock)> guard(lock);
 
@@ -207,7 +207,7 @@ void ByteBufferAsyncProcessor::put(Buffer::ByteArray new_data)
 		{
 			return;
 		}
-		data.emplace_back(std::move(new_data));
+		data.push_back(Package{std::move(new_data), now});
 	}
 	cv.notify_all();
 }
@@ -218,15 +218,15 @@ void ByteBufferAsyncProcessor::pause(const std::string& reason)
 
 	++interrupt_balance;
 
-	logger->debug("{} paused with reason={},state={}", id, reason, to_string(state));
+	RD_LOG_DEBUG(logger, "{} paused with reason={},state={}", id, reason, to_string(state));
 
 	auto current_thread_id = std::this_thread::get_id();
 	if (current_thread_id != async_thread_id)
 	{
-		logger->debug(id + "{} paused from another thread : {}", id, to_string(current_thread_id));
+		RD_LOG_DEBUG(logger, id + "{} paused from another thread : {}", id, to_string(current_thread_id));
 		std::unique_lock<decltype(processing_lock)> ul(processing_lock);
 		processing_cv.wait(ul, [this]() -> bool { return !in_processing; });
-		logger->debug("{}: pausing waited for main processing", id);
+		RD_LOG_DEBUG(logger, "{}: pausing waited for main processing", id);
 	}
 }
 
@@ -239,7 +239,7 @@ void ByteBufferAsyncProcessor::resume()
 
 		--interrupt_balance;
 
-		logger->debug("{} resumed", id);
+		RD_LOG_DEBUG(logger, "{} resumed", id);
 	}
 
 	cv.notify_all();
@@ -251,15 +251,30 @@ void ByteBufferAsyncProcessor::acknowledge(sequence_number_t seqn)
 
 	if (seqn > acknowledged_seqn)
 	{
-		logger->trace("{}: new acknowledged seqn: {}", this->id, seqn);
+		RD_LOG_TRACE(logger, "{}: new acknowledged seqn: {}", this->id, seqn);
 		acknowledged_seqn = seqn;
 	}
-	else
+	else if (seqn < acknowledged_seqn)
 	{
 		logger->error("Acknowledge {} called, while next seqn MUST BE greater than {}", seqn, acknowledged_seqn);
 	}
 }
 
+void ByteBufferAsyncProcessor::reset()
+{
+	std::lock_guard<decltype(lock)> guard(lock);
+	std::lock_guard<decltype(queue_lock)> queue_guard(queue_lock);
+
+	RD_LOG_DEBUG(logger, "{}: dropping {} unacknowledged and {} queued packages", this->id, pending_queue.size(), queue.size() + data.size());
+
+	data.clear();
+	queue.clear();
+	pending_queue.clear();
+	max_sent_seqn = 0;
+	current_seqn = 1;
+	acknowledged_seqn = 0;
+}
+
 std::string to_string(ByteBufferAsyncProcessor::StateKind state)
 {
 	switch (state)
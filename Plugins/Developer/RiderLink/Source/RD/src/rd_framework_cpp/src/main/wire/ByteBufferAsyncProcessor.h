@@ -34,6 +34,17 @@ public:
 		Terminated
 	};
 
+	/**
+	 * \brief Bytes given to [put] along with the moment they were put.
+	 */
+	struct Package
+	{
+		Buffer::ByteArray bytes;
+		std::chrono::steady_clock::time_point put_at;
+	};
+
+	using processor_t = std::function<bool(Package const&, sequence_number_t seqn)>;
+
 private:
 	using time_t = std::chrono::milliseconds;
 
@@ -44,7 +55,7 @@ private:
 
 	std::string id;
 
-	std::function<bool(Buffer::ByteArray const&, sequence_number_t seqn)> processor;
+	processor_t processor;
 
 	StateKind state{StateKind::Initialized};
 	static std::shared_ptr<spdlog::logger> logger;
@@ -52,10 +63,10 @@ private:
 	std::thread::id async_thread_id;
 	std::future<void> async_future;
 
-	std::vector<Buffer::ByteArray> data;
+	std::vector<Package> data;
 	std::mutex queue_lock;
-	std::deque<Buffer::ByteArray> queue{};
-	std::deque<Buffer::ByteArray> pending_queue{};
+	std::deque<Package> queue{};
+	std::deque<Package> pending_queue{};
 
 	sequence_number_t max_sent_seqn = 0;
 	sequence_number_t current_seqn = 1;
@@ -69,7 +80,7 @@ private:
 public:
 	// region ctor/dtor
 
-	explicit ByteBufferAsyncProcessor(std::string id, std::function<bool(Buffer::ByteArray const&, sequence_number_t)> processor);
+	explicit ByteBufferAsyncProcessor(std::string id, processor_t processor);
 
 	// endregion
 private:
@@ -77,7 +88,7 @@ private:
 
 	bool terminate0(time_t timeout, StateKind state_to_set, string_view action);
 
-	void add_data(std::vector<Buffer::ByteArray>&& new_data);
+	void add_data(std::vector<Package>&& new_data);
 
 	bool reprocess();
 
@@ -99,6 +110,12 @@ public:
 	void resume();
 
 	void acknowledge(int64_t seqn);
+
+	/**
+	 * \brief Drops everything put so far, acknowledged or not, and starts numbering packages from 1 again.
+	 * Used when the counterpart turns out to be a new session which has no use for them.
+	 */
+	void reset();
 };
 
 std::string to_string(ByteBufferAsyncProcessor::StateKind state);
@@ -0,0 +1,80 @@
+#include "RecordingWire.h"
+
+namespace rd
+{
+namespace
+{
+/**
+ * \brief Stands for the entity in the broker of the real wire, records messages before passing them on.
+ */
+class RecordingReactive final : public IRdReactive
+{
+	IRdReactive const* entity;
+	WireRecorder* recorder;
+
+public:
+	RecordingReactive(IRdReactive const* entity, WireRecorder* recorder) : entity(entity), recorder(recorder)
+	{
+		this->rdid = entity->rdid;
+		this->location = entity->location;
+		this->async = entity->async;
+	}
+
+	void bind(Lifetime, IRdDynamic const*, string_view) const override
+	{
+	}
+
+	void identify(Identities const&, RdId const&) const override
+	{
+	}
+
+	const IProtocol* get_protocol() const override
+	{
+		return entity->get_protocol();
+	}
+
+	SerializationCtx& get_serialization_context() const override
+	{
+		return entity->get_serialization_context();
+	}
+
+	IScheduler* get_wire_scheduler() const override
+	{
+		return entity->get_wire_scheduler();
+	}
+
+	void on_wire_received(Buffer buffer) const override
+	{
+		const size_t position = buffer.get_position();
+		Buffer::ByteArray message = std::move(buffer).getArray();
+		recorder->record(WireRecording::Direction::Received, rdid, message.data() + position, message.size() - position);
+		entity->on_wire_received(Buffer(std::move(message), position));
+	}
+};
+}	 // namespace
+
+RecordingWire::RecordingWire(Lifetime lifetime, std::shared_ptr<IWire> real_wire, std::string const& path)
+	: real_wire(std::move(real_wire)), recorder(path)
+{
+	this->real_wire->connected.advise(lifetime, [this](bool value) { connected.set(value); });
+	this->real_wire->heartbeatAlive.advise(lifetime, [this](bool value) { heartbeatAlive.set(value); });
+	this->real_wire->session.advise(lifetime, [this](int64_t value) { session.set(value); });
+}
+
+void RecordingWire::send(RdId const& id, std::function<void(Buffer& buffer)> writer) const
+{
+	Buffer buffer;
+	writer(buffer);
+	Buffer::ByteArray payload = std::move(buffer).getRealArray();
+	recorder.record(WireRecording::Direction::Sent, id, payload.data(), payload.size());
+	real_wire->send(id, [payload = std::move(payload)](Buffer& buffer) { buffer.write_byte_array_raw(payload); });
+}
+
+void RecordingWire::advise(Lifetime lifetime, IRdReactive const* entity) const
+{
+	auto proxy = std::make_shared<RecordingReactive>(entity, &recorder);
+	// released after the real wire has forgotten it, actions are executed in reverse order
+	lifetime->add_action([proxy]() {});
+	real_wire->advise(lifetime, proxy.get());
+}
+}	 // namespace rd
\ No newline at end of file
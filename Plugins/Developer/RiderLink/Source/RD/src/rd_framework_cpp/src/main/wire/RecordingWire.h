@@ -0,0 +1,49 @@
+#ifndef RD_CPP_RECORDINGWIRE_H
+#define RD_CPP_RECORDINGWIRE_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "base/IWire.h"
+#include "WireRecording.h"
+
+#include <memory>
+#include <string>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+/**
+ * \brief Decorates [real_wire] writing every package which is sent or received through it into a [WireRecording].
+ *
+ * Recordings are meant for profiling dispatch and deserialization offline, see [ReplayWire].
+ */
+class RD_FRAMEWORK_API RecordingWire final : public IWire
+{
+	std::shared_ptr<IWire> real_wire;
+
+	mutable WireRecorder recorder;
+
+public:
+	// region ctor/dtor
+
+	/**
+	 * \param lifetime within which state of [real_wire] is mirrored by this wire.
+	 */
+	RecordingWire(Lifetime lifetime, std::shared_ptr<IWire> real_wire, std::string const& path);
+
+	// endregion
+
+	void send(RdId const& id, std::function<void(Buffer& buffer)> writer) const override;
+
+	void advise(Lifetime lifetime, IRdReactive const* entity) const override;
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_RECORDINGWIRE_H
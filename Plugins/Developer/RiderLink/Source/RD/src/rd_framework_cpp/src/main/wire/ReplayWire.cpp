@@ -0,0 +1,69 @@
+#include "ReplayWire.h"
+
+#include <cstring>
+#include <thread>
+
+namespace rd
+{
+constexpr size_t ReplayWire::MAX_DISPATCH_BATCH;
+
+ReplayWire::ReplayWire(IScheduler* scheduler, std::string const& path) : WireBase(scheduler), recording(path)
+{
+	connected.set(true);
+}
+
+void ReplayWire::send(RdId const& /*id*/, std::function<void(Buffer& buffer)> writer) const
+{
+	Buffer buffer;
+	writer(buffer);
+}
+
+size_t ReplayWire::replay(WireRecording::Direction direction, bool original_speed) const
+{
+	const auto start = std::chrono::steady_clock::now();
+	auto first = std::chrono::nanoseconds::min();
+	size_t count = 0;
+
+	MessageBroker::batch_t batch;
+	for (auto const& package : recording.get_packages())
+	{
+		if (package.direction != direction)
+		{
+			continue;
+		}
+		// the broker skips the context which the recording doesn't keep
+		Buffer::ByteArray message(sizeof(int16_t) + package.size);
+		std::memcpy(message.data() + sizeof(int16_t), package.data, package.size);
+
+		if (original_speed)
+		{
+			if (first == std::chrono::nanoseconds::min())
+			{
+				first = package.timestamp;
+			}
+			std::this_thread::sleep_until(start + (package.timestamp - first));
+			message_broker.dispatch(package.id, Buffer(std::move(message)));
+		}
+		else
+		{
+			batch.emplace_back(package.id, Buffer(std::move(message)));
+			if (batch.size() >= MAX_DISPATCH_BATCH)
+			{
+				message_broker.dispatch(std::move(batch));
+				batch.clear();
+			}
+		}
+		++count;
+	}
+	if (!batch.empty())
+	{
+		message_broker.dispatch(std::move(batch));
+	}
+	return count;
+}
+
+WireRecording const& ReplayWire::get_recording() const
+{
+	return recording;
+}
+}	 // namespace rd
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef RD_CPP_REPLAYWIRE_H
+#define RD_CPP_REPLAYWIRE_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "base/WireBase.h"
+#include "WireRecording.h"
+
+#include <string>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+/**
+ * \brief Wire which receives packages from a [WireRecording] instead of a counterpart.
+ *
+ * Entities are bound to a [Protocol] over this wire as usual, [replay] then dispatches recorded packages to them
+ * the same way [SocketWire] does. Sent packages are serialized and dropped.
+ */
+class RD_FRAMEWORK_API ReplayWire final : public WireBase
+{
+	WireRecording recording;
+
+public:
+	/**
+	 * \brief Upper bound for packages handed to the broker at once when replaying at full speed.
+	 */
+	static constexpr size_t MAX_DISPATCH_BATCH = 1024;
+
+	// region ctor/dtor
+
+	ReplayWire(IScheduler* scheduler, std::string const& path);
+
+	// endregion
+
+	void send(RdId const& id, std::function<void(Buffer& buffer)> writer) const override;
+
+	/**
+	 * \brief Dispatches recorded packages of the given [direction] as if they had been received by this wire.
+	 *
+	 * \param original_speed keeps recorded intervals between packages, otherwise they go back to back.
+	 * \return number of dispatched packages
+	 */
+	size_t replay(WireRecording::Direction direction = WireRecording::Direction::Received, bool original_speed = false) const;
+
+	WireRecording const& get_recording() const;
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_REPLAYWIRE_H
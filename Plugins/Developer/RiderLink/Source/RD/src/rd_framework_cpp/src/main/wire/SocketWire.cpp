@@ -11,6 +11,8 @@
 #include <utility>
 #include <thread>
 #include <csignal>
+#include <random>
+#include <cstring>
 
 namespace rd
 {
@@ -21,10 +23,29 @@ std::chrono::milliseconds SocketWire::timeout = std::chrono::milliseconds(500);
 
 constexpr int32_t SocketWire::Base::ACK_MESSAGE_LENGTH;
 constexpr int32_t SocketWire::Base::PING_MESSAGE_LENGTH;
+constexpr int32_t SocketWire::Base::SESSION_MESSAGE_LENGTH;
 constexpr int32_t SocketWire::Base::PACKAGE_HEADER_LENGTH;
 
-SocketWire::Base::Base(std::string id, Lifetime parentLifetime, IScheduler* scheduler)
-	: WireBase(scheduler), id(std::move(id)), scheduler(scheduler), lifetimeDef(parentLifetime)
+static int64_t generate_session_token()
+{
+	std::random_device device;
+	std::mt19937_64 generator((static_cast<uint64_t>(device()) << 32) ^ device() ^
+							  static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+	int64_t token = 0;
+	while (token == 0)
+	{
+		token = static_cast<int64_t>(generator());
+	}
+	return token;
+}
+
+SocketWire::Base::Base(std::string id, Lifetime parentLifetime, IScheduler* scheduler, bool resume_sessions)
+	: WireBase(scheduler)
+	, id(std::move(id))
+	, scheduler(scheduler)
+	, resume_sessions(resume_sessions)
+	, session_token(generate_session_token())
+	, lifetimeDef(parentLifetime)
 {
 	async_send_buffer.pause("initial");
 	async_send_buffer.start();
@@ -47,14 +68,14 @@ void SocketWire::Base::receiverProc() const
 		{
 			if (!socket_provider->IsSocketValid())
 			{
-				logger->debug("{}: stop receive messages because socket disconnected", this->id);
+				RD_LOG_DEBUG(logger, "{}: stop receive messages because socket disconnected", this->id);
 				//					async_send_buffer.terminate();
 				break;
 			}
 
 			if (!read_and_dispatch_message())
 			{
-				logger->debug("{}: connection was gracefully shutdown", id);
+				RD_LOG_DEBUG(logger, "{}: connection was gracefully shutdown", id);
 				//					async_send_buffer.terminate();
 				break;
 			}
@@ -66,6 +87,7 @@ void SocketWire::Base::receiverProc() const
 			break;
 		}
 	}
+	dispatch_received();
 }
 
 bool SocketWire::Base::send0(Buffer::ByteArray const& msg, sequence_number_t seqn) const
@@ -91,7 +113,7 @@ bool SocketWire::Base::send0(Buffer::ByteArray const& msg, sequence_number_t seq
 																					 ": failed to send package over the network"
 																					 ", reason: " +
 																					 socket_provider->DescribeError());
-		logger->info("{}: were sent {} bytes", this->id, msglen);
+		RD_LOG_INFO(logger, "{}: were sent {} bytes", this->id, msglen);
 		//        RD_ASSERT_MSG(socketProvider->Flush(), "{}: failed to flush");
 		return true;
 	}
@@ -103,6 +125,26 @@ bool SocketWire::Base::send0(Buffer::ByteArray const& msg, sequence_number_t seq
 	}
 }
 
+bool SocketWire::Base::send_package(ByteBufferAsyncProcessor::Package const& package, sequence_number_t seqn) const
+{
+	if (!send0(package.bytes, seqn))
+	{
+		return false;
+	}
+	if (seqn > max_written_seqn)
+	{
+		max_written_seqn = seqn;
+		if (metrics.is_enabled())
+		{
+			// package starts with its length followed by the id
+			RdId::hash_t hash = 0;
+			std::memcpy(&hash, package.bytes.data() + sizeof(int32_t), sizeof(hash));
+			metrics.on_written(RdId(hash), std::chrono::steady_clock::now() - package.put_at);
+		}
+	}
+	return true;
+}
+
 void SocketWire::Base::send(RdId const& rd_id, std::function<void(Buffer& buffer)> writer) const
 {
 	RD_ASSERT_MSG(!rd_id.isNull(), "{}: id mustn't be null");
@@ -118,6 +160,10 @@ void SocketWire::Base::send(RdId const& rd_id, std::function<void(Buffer& buffer
 	local_send_buffer.rewind();
 	local_send_buffer.write_integral<int32_t>(len - 4);
 	local_send_buffer.set_position(len);
+	if (metrics.is_enabled())
+	{
+		metrics.on_sent(rd_id, len);
+	}
 	async_send_buffer.put(std::move(local_send_buffer).getRealArray());
 }
 
@@ -136,28 +182,47 @@ void SocketWire::Base::set_socket_provider(std::shared_ptr<CActiveSocket> new_so
 		}
 	}
 
-	auto heartbeat = LifetimeDefinition::use([this](Lifetime heartbeatLifetime) {
-		const auto heartbeat = start_heartbeat(heartbeatLifetime).share();
+	// the rest of a package interrupted by disconnect is going to be replayed as a whole
+	lo = hi = receiver_buffer.begin();
+	sz = -1;
+	id_ = -1;
+	message.rewind();
+	receive_pkg.rewind();
 
-		async_send_buffer.resume();
+	if (exchange_sessions())
+	{
+		auto heartbeat = LifetimeDefinition::use([this](Lifetime heartbeatLifetime) {
+			const auto heartbeat = start_heartbeat(heartbeatLifetime).share();
 
-		connected.set(true);
+			async_send_buffer.resume();
 
-		receiverProc();
+			connected.set(true);
 
-		connected.set(false);
+			receiverProc();
 
-		async_send_buffer.pause("Disconnected");
+			connected.set(false);
 
-		return heartbeat;
-	});
-	const auto status = heartbeat.wait_for(timeout);
+			async_send_buffer.pause("Disconnected");
 
-	logger->debug("{}: waited for heartbeat to stop with status: {}", this->id, status);
+			if (resume_sessions)
+			{
+				disconnected_at = std::chrono::steady_clock::now();
+			}
+			else
+			{
+				session.set(0);
+			}
+
+			return heartbeat;
+		});
+		const auto status = heartbeat.wait_for(timeout);
+
+		RD_LOG_DEBUG(logger, "{}: waited for heartbeat to stop with status: {}", this->id, status);
+	}
 
 	if (!socket_provider->IsSocketValid())
 	{
-		logger->debug("{}: socket was already shut down", this->id);
+		RD_LOG_DEBUG(logger, "{}: socket was already shut down", this->id);
 	}
 	else if (!socket_provider->Shutdown(CSimpleSocket::Both))
 	{
@@ -166,6 +231,83 @@ void SocketWire::Base::set_socket_provider(std::shared_ptr<CActiveSocket> new_so
 	}
 }
 
+bool SocketWire::Base::exchange_sessions()
+{
+	if (!resume_sessions)
+	{
+		session.set(++connections);
+		return true;
+	}
+
+	Buffer handshake{PACKAGE_HEADER_LENGTH + sizeof(sequence_number_t)};
+	handshake.write_integral(SESSION_MESSAGE_LENGTH);
+	handshake.write_integral(session_token);
+	handshake.write_integral(max_received_seqn);
+	{
+		std::lock_guard<decltype(socket_send_lock)> guard(socket_send_lock);
+		const int32_t len = static_cast<int32_t>(handshake.get_position());
+		if (socket_provider->Send(handshake.data(), len) != len)
+		{
+			logger->warn("{}: failed to send session over the network, reason: {}", this->id, socket_provider->DescribeError());
+			return false;
+		}
+	}
+
+	int32_t len = 0;
+	int64_t token = 0;
+	sequence_number_t received_seqn = 0;
+	if (!read_integral_from_socket(len))
+	{
+		return false;
+	}
+	if (len != SESSION_MESSAGE_LENGTH)
+	{
+		logger->error("{}: counterpart doesn't resume sessions, got header {} instead", this->id, len);
+		return false;
+	}
+	if (!read_integral_from_socket(token) || !read_integral_from_socket(received_seqn))
+	{
+		return false;
+	}
+
+	if (token == session.get())
+	{
+		RD_LOG_INFO(logger, "{}: session resumed, counterpart received packages up to seqn={}", this->id, received_seqn);
+		if (received_seqn > 0)
+		{
+			async_send_buffer.acknowledge(received_seqn);
+		}
+	}
+	else
+	{
+		RD_LOG_INFO(logger, "{}: new session of counterpart, token={}", this->id, token);
+		async_send_buffer.reset();
+		max_written_seqn = 0;
+		max_received_seqn = 0;
+		session.set(token);
+	}
+	return true;
+}
+
+void SocketWire::Base::expire_session()
+{
+	if (!resume_sessions || session.get() == 0 || connected.get())
+	{
+		return;
+	}
+	if (std::chrono::steady_clock::now() - disconnected_at < session_timeout)
+	{
+		return;
+	}
+	RD_LOG_INFO(logger, "{}: session {} expired", this->id, session.get());
+	// counterpart must not resume it either when it comes back
+	session_token = generate_session_token();
+	async_send_buffer.reset();
+	max_written_seqn = 0;
+	max_received_seqn = 0;
+	session.set(0);
+}
+
 bool SocketWire::Base::connection_established(int32_t timestamp, int32_t notion_timestamp)
 {
 	return timestamp - notion_timestamp <= MaximumHeartbeatDelay;
@@ -205,14 +347,16 @@ bool SocketWire::Base::read_from_socket(Buffer::word_t* res, int32_t msglen) con
 			{
 				hi = lo = receiver_buffer.begin();
 			}
-			logger->info("{}: receive started", this->id);
+			// the counterpart may be waiting for a response to one of these, don't hold them while blocked
+			dispatch_received();
+			RD_LOG_INFO(logger, "{}: receive started", this->id);
 			int32_t read = socket_provider->Receive(static_cast<int32_t>(receiver_buffer.end() - hi), &*hi);
 			if (read == -1)
 			{
 				auto err = socket_provider->GetSocketError();
 				if (err == CSimpleSocket::SocketInvalidSocket)
 				{
-					logger->info("{}: socket was shut down for receiving", this->id);
+					RD_LOG_INFO(logger, "{}: socket was shut down for receiving", this->id);
 					return false;
 				}
 				logger->error("{}: error has occurred while receiving", this->id);
@@ -220,13 +364,13 @@ bool SocketWire::Base::read_from_socket(Buffer::word_t* res, int32_t msglen) con
 			}
 			if (read == 0)
 			{
-				logger->info("{}: socket was shut down for receiving", this->id);
+				RD_LOG_INFO(logger, "{}: socket was shut down for receiving", this->id);
 				return false;
 			}
 			hi += read;
 			if (read > 0)
 			{
-				logger->info("{}: receive finished: {} bytes read", this->id, read);
+				RD_LOG_INFO(logger, "{}: receive finished: {} bytes read", this->id, read);
 			}
 		}
 	}
@@ -270,7 +414,7 @@ std::pair<int, sequence_number_t> SocketWire::Base::read_header() const
 			{
 				if (!heartbeatAlive.get())
 				{	 // only on change
-					logger->trace(
+					RD_LOG_TRACE(logger,
 						"Connection is alive after receiving PING {}: "
 						"received_timestamp: {}, "
 						"received_counterpart_timestamp: {}, "
@@ -300,34 +444,38 @@ std::pair<int, sequence_number_t> SocketWire::Base::read_header() const
 
 int32_t SocketWire::Base::read_package() const
 {
-	receive_pkg.rewind();
-
-	const auto pair = read_header();
-	if (pair == INVALID_HEADER)
+	while (true)
 	{
-		logger->debug("{}: failed to read header", this->id);
-		return -1;
-	}
-	const auto len = pair.first;
-	const auto seqn = pair.second;
+		receive_pkg.rewind();
 
-	logger->debug("{}: read len={}, seqn={}, max_received_seqn={}", this->id, len, seqn, max_received_seqn);
+		const auto pair = read_header();
+		if (pair == INVALID_HEADER)
+		{
+			RD_LOG_DEBUG(logger, "{}: failed to read header", this->id);
+			return -1;
+		}
+		const auto len = pair.first;
+		const auto seqn = pair.second;
 
-	receive_pkg.require_available(len);
-	if (!read_data_from_socket(receive_pkg.data(), len))
-	{
-		logger->debug("{}: failed to read package", this->id);
-		return -1;
-	}
-	send_ack(seqn);
-	if (seqn <= max_received_seqn && seqn != 1)
-	{
-		return true;
-	}
-	max_received_seqn = seqn;
+		RD_LOG_DEBUG(logger, "{}: read len={}, seqn={}, max_received_seqn={}", this->id, len, seqn, max_received_seqn);
+
+		receive_pkg.require_available(len);
+		if (!read_data_from_socket(receive_pkg.data(), len))
+		{
+			RD_LOG_DEBUG(logger, "{}: failed to read package", this->id);
+			return -1;
+		}
+		send_ack(seqn);
+		if (seqn <= max_received_seqn && seqn != 1)
+		{
+			// replayed by the counterpart which didn't get the ack in time
+			continue;
+		}
+		max_received_seqn = seqn;
 
-	logger->info("{}: was received package, bytes={}, seqn={}", this->id, len, seqn);
-	return len;
+		RD_LOG_INFO(logger, "{}: was received package, bytes={}, seqn={}", this->id, len, seqn);
+		return len;
+	}
 }
 
 bool SocketWire::Base::read_and_dispatch_message() const
@@ -335,7 +483,7 @@ bool SocketWire::Base::read_and_dispatch_message() const
 	sz = (sz == -1 ? receive_pkg.read_integral<int32_t>() : sz);
 	if (sz == -1)
 	{
-		logger->debug("{}: sz == -1", this->id);
+		RD_LOG_DEBUG(logger, "{}: sz == -1", this->id);
 		return false;
 	}
 	id_ = (id_ == -1 ? receive_pkg.read_integral<RdId::hash_t>() : id_);
@@ -344,7 +492,7 @@ bool SocketWire::Base::read_and_dispatch_message() const
 		logger->error("id == -1");
 		return false;
 	}
-	logger->trace("{}: message info: sz={}, id={}", this->id, sz, id_);
+	RD_LOG_TRACE(logger, "{}: message info: sz={}, id={}", this->id, sz, id_);
 	const RdId rd_id{id_};
 	sz -= 8;	// RdId
 	message.require_available(sz);
@@ -355,9 +503,18 @@ bool SocketWire::Base::read_and_dispatch_message() const
 		return false;
 	}
 
-	logger->debug("{}: message received", this->id);
-	message_broker.dispatch(rd_id, std::move(message));
-	logger->debug("{}: message dispatched", this->id);
+	RD_LOG_DEBUG(logger, "{}: message received", this->id);
+	if (metrics.is_enabled())
+	{
+		metrics.on_received(rd_id, sz + sizeof(int32_t) + sizeof(RdId::hash_t));
+	}
+	// the buffer may be larger than the message, entities shouldn't see the rest
+	message.set_position(sz);
+	received_batch.emplace_back(rd_id, Buffer(std::move(message).getRealArray()));
+	if (received_batch.size() >= MAX_DISPATCH_BATCH)
+	{
+		dispatch_received();
+	}
 
 	sz = -1;
 	id_ = -1;
@@ -366,6 +523,18 @@ bool SocketWire::Base::read_and_dispatch_message() const
 	//		RD_ASSERT_MSG(summary_size == sz, "Broken message, read:%d bytes, expected:%d bytes", summary_size, sz)
 }
 
+void SocketWire::Base::dispatch_received() const
+{
+	if (received_batch.empty())
+	{
+		return;
+	}
+	const size_t count = received_batch.size();
+	message_broker.dispatch(std::move(received_batch));
+	received_batch.clear();
+	RD_LOG_DEBUG(logger, "{}: {} messages dispatched", this->id, count);
+}
+
 CSimpleSocket* SocketWire::Base::get_socket_provider() const
 {
 	return socket_provider.get();
@@ -377,7 +546,7 @@ void SocketWire::Base::ping() const
 	{
 		if (heartbeatAlive.get())
 		{	 // only on change
-			logger->trace(
+			RD_LOG_TRACE(logger,
 				"Disconnect detected while sending PING {}: "
 				"current_timestamp: {}, "
 				"counterpart_timestamp: {}, "
@@ -396,7 +565,7 @@ void SocketWire::Base::ping() const
 			int32_t sent = socket_provider->Send(ping_pkg_header.data(), ping_pkg_header.get_position());
 			if (sent == 0 && !socket_provider->IsSocketValid())
 			{
-				logger->debug("{}: failed to send ping over the network, reason: socket was shut down for sending", this->id);
+				RD_LOG_DEBUG(logger, "{}: failed to send ping over the network, reason: socket was shut down for sending", this->id);
 				return;
 			}
 			RD_ASSERT_THROW_MSG(sent == PACKAGE_HEADER_LENGTH,
@@ -413,7 +582,7 @@ void SocketWire::Base::ping() const
 
 bool SocketWire::Base::send_ack(sequence_number_t seqn) const
 {
-	logger->trace("{} send ack {}", id, seqn);
+	RD_LOG_TRACE(logger, "{} send ack {}", id, seqn);
 	try
 	{
 		ack_buffer.rewind();
@@ -445,8 +614,9 @@ bool SocketWire::Base::try_shutdown_connection() const
 	return s->Shutdown(CSimpleSocket::Both);
 }
 
-SocketWire::Client::Client(Lifetime parentLifetime, IScheduler* scheduler, uint16_t port, const std::string& id)
-	: Base(id, parentLifetime, scheduler), port(port), clientLifetimeDefinition(parentLifetime)
+SocketWire::Client::Client(
+	Lifetime parentLifetime, IScheduler* scheduler, uint16_t port, const std::string& id, bool resume_sessions)
+	: Base(id, parentLifetime, scheduler, resume_sessions), port(port), clientLifetimeDefinition(parentLifetime)
 {
 	Lifetime lifetime = clientLifetimeDefinition.lifetime;
 	thread = std::thread([this, lifetime]() mutable {
@@ -470,7 +640,7 @@ SocketWire::Client::Client(Lifetime parentLifetime, IScheduler* scheduler, uint1
 
 					// https://stackoverflow.com/questions/22417228/prevent-tcp-socket-connection-retries
 					// HKLM\SYSTEM\CurrentControlSet\Services\Tcpip\Parameters\TcpMaxConnectRetransmissions
-					logger->info("{}: connecting 127.0.0.1: {}", this->id, this->port);
+					RD_LOG_INFO(logger, "{}: connecting 127.0.0.1: {}", this->id, this->port);
 					RD_ASSERT_THROW_MSG(socket->Open("127.0.0.1", this->port),
 						fmt::format("{}: failed to open ActiveSocket, reason: {}", this->id, socket->DescribeError()));
 					{
@@ -490,6 +660,7 @@ SocketWire::Client::Client(Lifetime parentLifetime, IScheduler* scheduler, uint1
 				catch (std::exception const& e)
 				{
 					(void) e;
+					expire_session();
 					std::lock_guard<decltype(lock)> guard(lock);
 					bool should_reconnect = false;
 					if (!lifetime->is_terminated())
@@ -507,20 +678,20 @@ SocketWire::Client::Client(Lifetime parentLifetime, IScheduler* scheduler, uint1
 		}
 		catch (std::exception const& e)
 		{
-			logger->info("{}: closed with exception: {}", this->id, e.what());
+			RD_LOG_INFO(logger, "{}: closed with exception: {}", this->id, e.what());
 		}
-		logger->debug("{}: thread expired", this->id);
+		RD_LOG_DEBUG(logger, "{}: thread expired", this->id);
 	});
 
 	lifetime->add_action([this]() {
-		logger->info("{}: starts terminating lifetime", this->id);
+		RD_LOG_INFO(logger, "{}: starts terminating lifetime", this->id);
 
 		const bool send_buffer_stopped = async_send_buffer.stop(timeout);
-		logger->debug("{}: send buffer stopped, success: {}", this->id, send_buffer_stopped);
+		RD_LOG_DEBUG(logger, "{}: send buffer stopped, success: {}", this->id, send_buffer_stopped);
 
 		{
 			std::lock_guard<decltype(lock)> guard(lock);
-			logger->debug("{}: closing socket", this->id);
+			RD_LOG_DEBUG(logger, "{}: closing socket", this->id);
 
 			if (socket != nullptr)
 			{
@@ -532,10 +703,10 @@ SocketWire::Client::Client(Lifetime parentLifetime, IScheduler* scheduler, uint1
 		}
 		cv.notify_all();
 
-		logger->debug("{}: waiting for receiver thread", this->id);
-		logger->debug("{}: is thread joinable? {}", this->id, thread.joinable());
+		RD_LOG_DEBUG(logger, "{}: waiting for receiver thread", this->id);
+		RD_LOG_DEBUG(logger, "{}: is thread joinable? {}", this->id, thread.joinable());
 		thread.join();
-		logger->info("{}: termination finished", this->id);
+		RD_LOG_INFO(logger, "{}: termination finished", this->id);
 	});
 }
 
@@ -547,8 +718,9 @@ SocketWire::Client::~Client()
 	}
 }
 
-SocketWire::Server::Server(Lifetime parentLifetime, IScheduler* scheduler, uint16_t port, const std::string& id)
-	: Base(id, parentLifetime, scheduler), ss(std::make_unique<CPassiveSocket>()), serverLifetimeDefinition(parentLifetime)
+SocketWire::Server::Server(
+	Lifetime parentLifetime, IScheduler* scheduler, uint16_t port, const std::string& id, bool resume_sessions)
+	: Base(id, parentLifetime, scheduler, resume_sessions), ss(std::make_unique<CPassiveSocket>()), serverLifetimeDefinition(parentLifetime)
 {
 #ifdef SIGPIPE
 	signal(SIGPIPE, SIG_IGN);
@@ -560,7 +732,7 @@ SocketWire::Server::Server(Lifetime parentLifetime, IScheduler* scheduler, uint1
 	this->port = ss->GetServerPort();
 	RD_ASSERT_MSG(this->port != 0, fmt::format("{}: port wasn't chosen", this->id));
 
-	logger->info("{}: listening 127.0.0.1/{}", this->id, this->port);
+	RD_LOG_INFO(logger, "{}: listening 127.0.0.1/{}", this->id, this->port);
 	Lifetime lifetime = serverLifetimeDefinition.lifetime;
 
 	thread = std::thread([this, lifetime]() mutable {
@@ -570,19 +742,22 @@ SocketWire::Server::Server(Lifetime parentLifetime, IScheduler* scheduler, uint1
 		{
 			try
 			{
-				logger->info("{}: accepting started", this->id);
+				RD_LOG_INFO(logger, "{}: accepting started", this->id);
 				
 				// [HACK]: Fix RIDER-51111.
 				// winsock blocking accept hangs after creating new process with createprocess with inheritHandles=true
 				// property. Unreal Engine uses the same logic for handling sockets where they wait for timeout on select
 				// before trying to accept connection.
-				while(ss->IsSocketValid() && !ss->Select(0, 300)){}
+				while(ss->IsSocketValid() && !ss->Select(0, 300))
+				{
+					expire_session();
+				}
 				
 				CActiveSocket* accepted = ss->Accept();
 				RD_ASSERT_THROW_MSG(
 					accepted != nullptr, fmt::format("{}: accepting failed, reason: {}", this->id, ss->DescribeError()));
 				socket.reset(accepted);
-				logger->info("{}: accepted passive socket {}/{}", this->id, socket->GetClientAddr(), socket->GetClientPort());
+				RD_LOG_INFO(logger, "{}: accepted passive socket {}/{}", this->id, socket->GetClientAddr(), socket->GetClientPort());
 				RD_ASSERT_THROW_MSG(socket->DisableNagleAlgoritm(),
 					fmt::format("{}: tcpNoDelay failed, reason: {}", this->id, socket->DescribeError()));
 
@@ -590,33 +765,33 @@ SocketWire::Server::Server(Lifetime parentLifetime, IScheduler* scheduler, uint1
 					std::lock_guard<decltype(lock)> guard(lock);
 					if (lifetime->is_terminated())
 					{
-						logger->debug("{}: closing passive socket", this->id);
+						RD_LOG_DEBUG(logger, "{}: closing passive socket", this->id);
 						if (!socket->Close())
 						{
 							logger->error("{}: failed to close socket", this->id);
 						}
-						logger->info("{}: close passive socket", this->id);
+						RD_LOG_INFO(logger, "{}: close passive socket", this->id);
 					}
 				}
 
-				logger->debug("{}: setting socket provider", this->id);
+				RD_LOG_DEBUG(logger, "{}: setting socket provider", this->id);
 				set_socket_provider(socket);
 			}
 			catch (std::exception const& e)
 			{
-				logger->info("{}: closed with exception: {}", this->id, e.what());
+				RD_LOG_INFO(logger, "{}: closed with exception: {}", this->id, e.what());
 			}
 		}
-		logger->debug("{}: thread expired", this->id);
+		RD_LOG_DEBUG(logger, "{}: thread expired", this->id);
 	});
 
 	lifetime->add_action([this] {
-		logger->info("{}: start terminating lifetime", this->id);
+		RD_LOG_INFO(logger, "{}: start terminating lifetime", this->id);
 
 		const bool send_buffer_stopped = async_send_buffer.stop(timeout);
-		logger->debug("{}: send buffer stopped, success: {}", this->id, send_buffer_stopped);
+		RD_LOG_DEBUG(logger, "{}: send buffer stopped, success: {}", this->id, send_buffer_stopped);
 
-		logger->debug("{}: closing server socket", this->id);
+		RD_LOG_DEBUG(logger, "{}: closing server socket", this->id);
 		if (!ss->Close())
 		{
 			logger->error("{}: failed to close server socket", this->id);
@@ -624,7 +799,7 @@ SocketWire::Server::Server(Lifetime parentLifetime, IScheduler* scheduler, uint1
 
 		{
 			std::lock_guard<decltype(lock)> guard(lock);
-			logger->debug("{}: closing socket", this->id);
+			RD_LOG_DEBUG(logger, "{}: closing socket", this->id);
 			if (socket != nullptr)
 			{
 				if (!socket->Close())
@@ -634,10 +809,10 @@ SocketWire::Server::Server(Lifetime parentLifetime, IScheduler* scheduler, uint1
 			}
 		}
 
-		logger->debug("{}: waiting for receiver thread", this->id);
-		logger->debug("{}: is thread joinable? {}", this->id, thread.joinable());
+		RD_LOG_DEBUG(logger, "{}: waiting for receiver thread", this->id);
+		RD_LOG_DEBUG(logger, "{}: is thread joinable? {}", this->id, thread.joinable());
 		thread.join();
-		logger->info("{}: termination finished", this->id);
+		RD_LOG_INFO(logger, "{}: termination finished", this->id);
 	});
 }
 
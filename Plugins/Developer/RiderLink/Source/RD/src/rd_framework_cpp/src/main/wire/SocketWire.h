@@ -13,6 +13,7 @@
 
 #include <string>
 #include <array>
+#include <chrono>
 #include <condition_variable>
 
 #include <rd_framework_export.h>
@@ -47,7 +48,14 @@ public:
 
 		mutable std::condition_variable socket_send_var;
 		mutable ByteBufferAsyncProcessor async_send_buffer{id + "-AsyncSendProcessor",
-			[this](Buffer::ByteArray const& it, sequence_number_t seqn) -> bool { return this->send0(it, seqn); }};
+			[this](ByteBufferAsyncProcessor::Package const& it, sequence_number_t seqn) -> bool { return this->send_package(it, seqn); }};
+
+		/**
+		 * \brief The greatest seqn written to a socket so far, packages up to it are being resent.
+		 */
+		mutable sequence_number_t max_written_seqn = 0;
+
+		bool send_package(ByteBufferAsyncProcessor::Package const& package, sequence_number_t seqn) const;
 
 		static constexpr size_t RECEIVE_BUFFER_SIZE = 1u << 16;
 		mutable std::array<Buffer::word_t, RECEIVE_BUFFER_SIZE> receiver_buffer{};
@@ -55,6 +63,7 @@ public:
 
 		static constexpr int32_t ACK_MESSAGE_LENGTH = -1;
 		static constexpr int32_t PING_MESSAGE_LENGTH = -2;
+		static constexpr int32_t SESSION_MESSAGE_LENGTH = -3;
 		static constexpr int32_t PACKAGE_HEADER_LENGTH = sizeof(ACK_MESSAGE_LENGTH) + sizeof(sequence_number_t);
 		mutable Buffer ack_buffer{PACKAGE_HEADER_LENGTH};
 
@@ -85,6 +94,50 @@ public:
 
 		mutable Buffer message{CHUNK_SIZE};
 
+		// region session
+		/**
+		 * \brief Keeps [session] across reconnects of the same counterpart: unacknowledged packages are replayed and
+		 * bound entities stay intact. Requires the counterpart to resume sessions as well, the handshake is not understood
+		 * by wires which don't.
+		 */
+		const bool resume_sessions;
+
+		/**
+		 * \brief Identifies this wire to the counterpart, sent at the start of every connection if [resume_sessions] is on.
+		 */
+		int64_t session_token;
+
+		/**
+		 * \brief Number of connections so far, serves as [session] when sessions aren't resumed.
+		 */
+		int64_t connections = 0;
+
+		std::chrono::steady_clock::time_point disconnected_at{};
+
+		/**
+		 * \brief Exchanges session tokens and received sequence numbers with the counterpart before any package is sent.
+		 * Packages already received by the same session are acknowledged, so only the rest is replayed, a new session
+		 * starts from scratch.
+		 */
+		bool exchange_sessions();
+
+		/**
+		 * \brief Ends [session] if the counterpart hasn't come back within [session_timeout].
+		 */
+		void expire_session();
+		// endregion
+
+		/**
+		 * \brief Upper bound for messages handed to the broker at once when the counterpart keeps the socket saturated.
+		 */
+		static constexpr size_t MAX_DISPATCH_BATCH = 1024;
+		mutable MessageBroker::batch_t received_batch;
+
+		/**
+		 * \brief Hands [received_batch] over to the broker, called right before the receiver blocks on the socket.
+		 */
+		void dispatch_received() const;
+
 		bool read_from_socket(Buffer::word_t* res, int32_t msglen) const;
 
 		template <typename T>
@@ -105,10 +158,14 @@ public:
 	public:
 		static constexpr int32_t MaximumHeartbeatDelay = 3;
 		std::chrono::milliseconds heartBeatInterval = std::chrono::milliseconds(500);
+		/**
+		 * \brief How long a session outlives its connection waiting for the counterpart to resume it.
+		 */
+		std::chrono::milliseconds session_timeout = std::chrono::seconds(30);
 
 		// region ctor/dtor
 
-		Base(std::string id, Lifetime lifetime, IScheduler* scheduler);
+		Base(std::string id, Lifetime lifetime, IScheduler* scheduler, bool resume_sessions);
 
 		virtual ~Base() override;
 
@@ -147,7 +204,8 @@ public:
 
 		// region ctor/dtor
 
-		Client(Lifetime parentLifetime, IScheduler* scheduler, uint16_t port = 0, const std::string& id = "ClientSocket");
+		Client(Lifetime parentLifetime, IScheduler* scheduler, uint16_t port = 0, const std::string& id = "ClientSocket",
+			bool resume_sessions = false);
 
 		virtual ~Client() override;
 		// endregion
@@ -166,7 +224,8 @@ public:
 
 		// region ctor/dtor
 
-		Server(Lifetime lifetime, IScheduler* scheduler, uint16_t port = 0, const std::string& id = "ServerSocket");
+		Server(Lifetime lifetime, IScheduler* scheduler, uint16_t port = 0, const std::string& id = "ServerSocket",
+			bool resume_sessions = false);
 
 		virtual ~Server() override;
 		// endregion
@@ -0,0 +1,188 @@
+#include "WireMetrics.h"
+
+#include <util/thread_util.h>
+
+#include "spdlog/sinks/stdout_color_sinks.h"
+
+#include <algorithm>
+#include <condition_variable>
+
+namespace rd
+{
+namespace
+{
+std::shared_ptr<spdlog::logger> logger =
+	spdlog::stderr_color_mt<spdlog::synchronous_factory>("wireMetrics", spdlog::color_mode::automatic);
+
+std::atomic<uint64_t> next_instance_id{1};
+
+template <typename T, typename V>
+void add(std::atomic<T>& counter, V value)
+{
+	// only the owning thread writes to a shard
+	counter.store(counter.load(std::memory_order_relaxed) + static_cast<T>(value), std::memory_order_relaxed);
+}
+
+int64_t average_us(std::chrono::nanoseconds total, uint64_t count)
+{
+	return count == 0 ? 0 : std::chrono::duration_cast<std::chrono::microseconds>(total).count() / static_cast<int64_t>(count);
+}
+}	 // namespace
+
+WireMetrics::WireMetrics() : instance_id(next_instance_id++)
+{
+}
+
+WireMetrics::Counters& WireMetrics::counters(RdId const& id) const
+{
+	struct Cache
+	{
+		uint64_t instance_id = 0;
+		Shard* shard = nullptr;
+	};
+	thread_local Cache cache;
+
+	if (cache.instance_id != instance_id)
+	{
+		std::lock_guard<decltype(shards_lock)> guard(shards_lock);
+		auto& shard = shards[std::this_thread::get_id()];
+		if (shard == nullptr)
+		{
+			shard = std::make_unique<Shard>();
+		}
+		cache.instance_id = instance_id;
+		cache.shard = shard.get();
+	}
+
+	Shard& shard = *cache.shard;
+	auto it = shard.counters.find(id.get_hash());
+	if (it != shard.counters.end())
+	{
+		return it->second;
+	}
+	std::lock_guard<decltype(shard.lock)> guard(shard.lock);
+	return shard.counters[id.get_hash()];
+}
+
+void WireMetrics::enable()
+{
+	enabled = true;
+}
+
+void WireMetrics::on_sent(RdId const& id, size_t bytes) const
+{
+	Counters& it = counters(id);
+	add(it.messages_sent, 1);
+	add(it.bytes_sent, bytes);
+}
+
+void WireMetrics::on_written(RdId const& id, std::chrono::nanoseconds queue_delay) const
+{
+	add(counters(id).queue_delay, queue_delay.count());
+}
+
+void WireMetrics::on_received(RdId const& id, size_t bytes) const
+{
+	Counters& it = counters(id);
+	add(it.messages_received, 1);
+	add(it.bytes_received, bytes);
+}
+
+void WireMetrics::on_handled(RdId const& id, std::chrono::nanoseconds handler_time) const
+{
+	add(counters(id).handler_time, handler_time.count());
+}
+
+WireMetrics::snapshot_t WireMetrics::snapshot() const
+{
+	std::unordered_map<RdId::hash_t, Stats> total;
+	{
+		std::lock_guard<decltype(shards_lock)> guard(shards_lock);
+		for (auto const& shard : shards)
+		{
+			std::lock_guard<decltype(shard.second->lock)> shard_guard(shard.second->lock);
+			for (auto const& it : shard.second->counters)
+			{
+				Stats& stats = total[it.first];
+				Counters const& counters = it.second;
+				stats.id = RdId(it.first);
+				stats.messages_sent += counters.messages_sent.load(std::memory_order_relaxed);
+				stats.bytes_sent += counters.bytes_sent.load(std::memory_order_relaxed);
+				stats.messages_received += counters.messages_received.load(std::memory_order_relaxed);
+				stats.bytes_received += counters.bytes_received.load(std::memory_order_relaxed);
+				stats.queue_delay += std::chrono::nanoseconds(counters.queue_delay.load(std::memory_order_relaxed));
+				stats.handler_time += std::chrono::nanoseconds(counters.handler_time.load(std::memory_order_relaxed));
+			}
+		}
+	}
+
+	snapshot_t result;
+	result.reserve(total.size());
+	for (auto& it : total)
+	{
+		result.push_back(it.second);
+	}
+	std::sort(result.begin(), result.end(), [](Stats const& lhs, Stats const& rhs) {
+		return lhs.bytes_sent + lhs.bytes_received > rhs.bytes_sent + rhs.bytes_received;
+	});
+	return result;
+}
+
+void WireMetrics::report(Lifetime lifetime, std::chrono::milliseconds interval, size_t top) const
+{
+	RD_ASSERT_THROW_MSG(!lifetime->is_eternal(), "metrics can't be reported within eternal lifetime, the reporter would never stop");
+	if (lifetime->is_terminated())
+	{
+		return;
+	}
+
+	struct State
+	{
+		std::mutex lock;
+		std::condition_variable cv;
+		bool stopped = false;
+	};
+	auto state = std::make_shared<State>();
+
+	auto reporter = std::make_shared<std::thread>([this, state, interval, top]() {
+		util::set_thread_name("WireMetrics Reporter");
+
+		std::unique_lock<decltype(state->lock)> ul(state->lock);
+		while (!state->cv.wait_for(ul, interval, [&state]() { return state->stopped; }))
+		{
+			ul.unlock();
+
+			const snapshot_t stats = snapshot();
+			logger->info("{} entities sent or received messages", stats.size());
+			for (size_t i = 0; i < (std::min)(top, stats.size()); ++i)
+			{
+				Stats const& it = stats[i];
+				logger->info("{}: sent {} messages / {} bytes, {} us in queue on average; received {} messages / {} bytes, "
+							 "{} us in handler on average",
+					to_string(it.id), it.messages_sent, it.bytes_sent, average_us(it.queue_delay, it.messages_sent),
+					it.messages_received, it.bytes_received, average_us(it.handler_time, it.messages_received));
+			}
+			reported.fire(stats);
+
+			ul.lock();
+		}
+	});
+
+	lifetime->add_action([state, reporter]() {
+		{
+			std::lock_guard<decltype(state->lock)> guard(state->lock);
+			state->stopped = true;
+		}
+		state->cv.notify_all();
+		if (reporter->get_id() == std::this_thread::get_id())
+		{
+			// lifetime was terminated by a listener of [reported]
+			reporter->detach();
+		}
+		else
+		{
+			reporter->join();
+		}
+	});
+}
+}	 // namespace rd
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef RD_CPP_WIREMETRICS_H
+#define RD_CPP_WIREMETRICS_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "protocol/RdId.h"
+#include "lifetime/Lifetime.h"
+#include "reactive/base/SignalX.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+/**
+ * \brief Traffic of a wire per entity: messages, bytes, time spent in the send queue and in handlers.
+ *
+ * Every thread counts into its own shard, so recording is a hash lookup and a few relaxed stores.
+ * The shard lock is taken only when a thread meets an id for the first time and when a snapshot is made.
+ */
+class RD_FRAMEWORK_API WireMetrics
+{
+public:
+	struct Stats
+	{
+		RdId id;
+		uint64_t messages_sent = 0;
+		uint64_t bytes_sent = 0;
+		uint64_t messages_received = 0;
+		uint64_t bytes_received = 0;
+		/**
+		 * \brief Total time sent messages spent between being put into the send queue and written to the socket.
+		 */
+		std::chrono::nanoseconds queue_delay{0};
+		/**
+		 * \brief Total time spent in [IRdReactive::on_wire_received] of the entity.
+		 */
+		std::chrono::nanoseconds handler_time{0};
+	};
+
+	using snapshot_t = std::vector<Stats>;
+
+private:
+	struct Counters
+	{
+		std::atomic<uint64_t> messages_sent{0};
+		std::atomic<uint64_t> bytes_sent{0};
+		std::atomic<uint64_t> messages_received{0};
+		std::atomic<uint64_t> bytes_received{0};
+		std::atomic<int64_t> queue_delay{0};
+		std::atomic<int64_t> handler_time{0};
+	};
+
+	struct Shard
+	{
+		/**
+		 * \brief Guards insertions into [counters] against snapshots, the owning thread looks up without it.
+		 */
+		std::mutex lock;
+		std::unordered_map<RdId::hash_t, Counters> counters;
+	};
+
+	/**
+	 * \brief Tells apart instances in the thread local cache of shards.
+	 */
+	const uint64_t instance_id;
+
+	std::atomic_bool enabled{false};
+
+	mutable std::mutex shards_lock;
+	mutable std::unordered_map<std::thread::id, std::unique_ptr<Shard>> shards;
+
+	Counters& counters(RdId const& id) const;
+
+public:
+	/**
+	 * \brief Fired by [report] with snapshots sorted by bytes sent and received.
+	 */
+	Signal<snapshot_t> reported;
+
+	// region ctor/dtor
+
+	WireMetrics();
+
+	WireMetrics(WireMetrics const&) = delete;
+
+	WireMetrics& operator=(WireMetrics const&) = delete;
+
+	// endregion
+
+	/**
+	 * \brief Starts counting, nothing is recorded before.
+	 */
+	void enable();
+
+	bool is_enabled() const
+	{
+		return enabled.load(std::memory_order_relaxed);
+	}
+
+	void on_sent(RdId const& id, size_t bytes) const;
+
+	void on_written(RdId const& id, std::chrono::nanoseconds queue_delay) const;
+
+	void on_received(RdId const& id, size_t bytes) const;
+
+	void on_handled(RdId const& id, std::chrono::nanoseconds handler_time) const;
+
+	/**
+	 * \brief Sums up shards of all threads, entities which sent and received most bytes go first.
+	 */
+	snapshot_t snapshot() const;
+
+	/**
+	 * \brief Logs [top] entities of a snapshot and fires [reported] with it every [interval] within [lifetime].
+	 */
+	void report(Lifetime lifetime, std::chrono::milliseconds interval, size_t top = 10) const;
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_WIREMETRICS_H
@@ -0,0 +1,276 @@
+#include "WireRecording.h"
+
+#include "util/core_util.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+namespace rd
+{
+namespace detail
+{
+// region MappedFile
+
+#ifdef _WIN32
+MappedFile::MappedFile(std::string const& path, bool writable) : writable(writable)
+{
+	HANDLE handle = CreateFileA(path.c_str(), writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr,
+		writable ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	RD_ASSERT_THROW_MSG(handle != INVALID_HANDLE_VALUE, "failed to open " + path + ", error " + std::to_string(GetLastError()));
+	file = reinterpret_cast<intptr_t>(handle);
+
+	if (!writable)
+	{
+		LARGE_INTEGER file_size;
+		RD_ASSERT_THROW_MSG(GetFileSizeEx(handle, &file_size), "failed to get size of " + path);
+		length = static_cast<size_t>(file_size.QuadPart);
+		map();
+	}
+}
+
+void MappedFile::map()
+{
+	if (length == 0)
+	{
+		return;
+	}
+	const auto size = static_cast<uint64_t>(length);
+	HANDLE handle = CreateFileMappingA(reinterpret_cast<HANDLE>(file), nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+		static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr);
+	RD_ASSERT_THROW_MSG(handle != nullptr, "failed to map file, error " + std::to_string(GetLastError()));
+	mapping = reinterpret_cast<intptr_t>(handle);
+
+	view = static_cast<Buffer::word_t*>(MapViewOfFile(handle, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, length));
+	RD_ASSERT_THROW_MSG(view != nullptr, "failed to map view of file, error " + std::to_string(GetLastError()));
+}
+
+void MappedFile::unmap()
+{
+	if (view != nullptr)
+	{
+		UnmapViewOfFile(view);
+		view = nullptr;
+	}
+	if (mapping != 0)
+	{
+		CloseHandle(reinterpret_cast<HANDLE>(mapping));
+		mapping = 0;
+	}
+}
+
+void MappedFile::close(size_t new_length)
+{
+	if (file == -1)
+	{
+		return;
+	}
+	unmap();
+	if (writable)
+	{
+		LARGE_INTEGER position;
+		position.QuadPart = static_cast<LONGLONG>(new_length);
+		SetFilePointerEx(reinterpret_cast<HANDLE>(file), position, nullptr, FILE_BEGIN);
+		SetEndOfFile(reinterpret_cast<HANDLE>(file));
+	}
+	CloseHandle(reinterpret_cast<HANDLE>(file));
+	file = -1;
+	length = 0;
+}
+#else
+MappedFile::MappedFile(std::string const& path, bool writable) : writable(writable)
+{
+	file = ::open(path.c_str(), writable ? O_RDWR | O_CREAT | O_TRUNC : O_RDONLY, 0644);
+	RD_ASSERT_THROW_MSG(file != -1, "failed to open " + path + ", errno " + std::to_string(errno));
+
+	if (!writable)
+	{
+		struct stat file_stat
+		{
+		};
+		RD_ASSERT_THROW_MSG(fstat(static_cast<int>(file), &file_stat) == 0, "failed to get size of " + path);
+		length = static_cast<size_t>(file_stat.st_size);
+		map();
+	}
+}
+
+void MappedFile::map()
+{
+	if (length == 0)
+	{
+		return;
+	}
+	void* address = mmap(nullptr, length, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, static_cast<int>(file), 0);
+	RD_ASSERT_THROW_MSG(address != MAP_FAILED, "failed to map file, errno " + std::to_string(errno));
+	view = static_cast<Buffer::word_t*>(address);
+}
+
+void MappedFile::unmap()
+{
+	if (view != nullptr)
+	{
+		munmap(view, length);
+		view = nullptr;
+	}
+}
+
+void MappedFile::close(size_t new_length)
+{
+	if (file == -1)
+	{
+		return;
+	}
+	unmap();
+	if (writable && ftruncate(static_cast<int>(file), static_cast<off_t>(new_length)) != 0)
+	{
+		spdlog::error("failed to truncate mapped file, errno {}", errno);
+	}
+	::close(static_cast<int>(file));
+	file = -1;
+	length = 0;
+}
+#endif
+
+MappedFile::~MappedFile()
+{
+	close(length);
+}
+
+void MappedFile::resize(size_t new_length)
+{
+	RD_ASSERT_MSG(writable, "file is mapped for reading only");
+	unmap();
+#ifndef _WIN32
+	// mapping extends the file on Windows
+	RD_ASSERT_THROW_MSG(ftruncate(static_cast<int>(file), static_cast<off_t>(new_length)) == 0,
+		"failed to resize file, errno " + std::to_string(errno));
+#endif
+	length = new_length;
+	map();
+}
+
+Buffer::word_t* MappedFile::data() const
+{
+	return view;
+}
+
+size_t MappedFile::size() const
+{
+	return length;
+}
+
+// endregion
+}	 // namespace detail
+
+// region WireRecording
+
+constexpr char WireRecording::MAGIC[4];
+constexpr int32_t WireRecording::VERSION;
+constexpr size_t WireRecording::HEADER_SIZE;
+constexpr size_t WireRecording::RECORD_HEADER_SIZE;
+
+WireRecording::WireRecording(std::string const& path) : file(path, false)
+{
+	Buffer::word_t const* data = file.data();
+	const size_t size = file.size();
+
+	int32_t version = 0;
+	RD_ASSERT_THROW_MSG(size >= HEADER_SIZE && std::equal(MAGIC, MAGIC + sizeof(MAGIC), data), path + " is not a wire recording");
+	std::memcpy(&version, data + sizeof(MAGIC), sizeof(version));
+	RD_ASSERT_THROW_MSG(version == VERSION, path + " has unsupported version " + std::to_string(version));
+
+	size_t position = HEADER_SIZE;
+	while (position + RECORD_HEADER_SIZE <= size)
+	{
+		int64_t timestamp = 0;
+		Direction direction{};
+		RdId::hash_t id = 0;
+		int32_t length = 0;
+		Buffer::word_t const* record = data + position;
+		std::memcpy(&timestamp, record, sizeof(timestamp));
+		record += sizeof(timestamp);
+		std::memcpy(&direction, record, sizeof(direction));
+		record += sizeof(direction);
+		std::memcpy(&id, record, sizeof(id));
+		record += sizeof(id);
+		std::memcpy(&length, record, sizeof(length));
+		record += sizeof(length);
+
+		if (length < 0 || position + RECORD_HEADER_SIZE + length > size)
+		{
+			// recording process was killed in the middle of a write
+			break;
+		}
+		packages.push_back(Package{std::chrono::nanoseconds(timestamp), direction, RdId(id), record, length});
+		position += RECORD_HEADER_SIZE + length;
+	}
+}
+
+std::vector<WireRecording::Package> const& WireRecording::get_packages() const
+{
+	return packages;
+}
+
+// endregion
+
+// region WireRecorder
+
+WireRecorder::WireRecorder(std::string const& path, size_t initial_capacity) : file(path, true)
+{
+	file.resize((std::max)(initial_capacity, WireRecording::HEADER_SIZE));
+	Buffer::word_t* data = file.data();
+	std::memcpy(data, WireRecording::MAGIC, sizeof(WireRecording::MAGIC));
+	std::memcpy(data + sizeof(WireRecording::MAGIC), &WireRecording::VERSION, sizeof(WireRecording::VERSION));
+	used = WireRecording::HEADER_SIZE;
+}
+
+WireRecorder::~WireRecorder()
+{
+	std::lock_guard<decltype(lock)> guard(lock);
+	file.close(used);
+}
+
+void WireRecorder::record(WireRecording::Direction direction, RdId const& id, Buffer::word_t const* data, size_t size)
+{
+	const int64_t timestamp =
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	const RdId::hash_t hash = id.get_hash();
+	const auto length = static_cast<int32_t>(size);
+	const size_t record_size = WireRecording::RECORD_HEADER_SIZE + size;
+
+	std::lock_guard<decltype(lock)> guard(lock);
+	if (used + record_size > file.size())
+	{
+		file.resize((std::max)(file.size() * 2, used + record_size));
+	}
+	Buffer::word_t* record = file.data() + used;
+	std::memcpy(record, &timestamp, sizeof(timestamp));
+	record += sizeof(timestamp);
+	std::memcpy(record, &direction, sizeof(direction));
+	record += sizeof(direction);
+	std::memcpy(record, &hash, sizeof(hash));
+	record += sizeof(hash);
+	std::memcpy(record, &length, sizeof(length));
+	record += sizeof(length);
+	std::memcpy(record, data, size);
+	used += record_size;
+}
+
+size_t WireRecorder::get_size()
+{
+	std::lock_guard<decltype(lock)> guard(lock);
+	return used;
+}
+
+// endregion
+}	 // namespace rd
\ No newline at end of file
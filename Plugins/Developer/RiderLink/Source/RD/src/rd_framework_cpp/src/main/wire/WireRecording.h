@@ -0,0 +1,153 @@
+#ifndef RD_CPP_WIRERECORDING_H
+#define RD_CPP_WIRERECORDING_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "protocol/Buffer.h"
+#include "protocol/RdId.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+namespace detail
+{
+/**
+ * \brief File mapped into memory as a whole, remapped when it's resized.
+ */
+class RD_FRAMEWORK_API MappedFile
+{
+	intptr_t file = -1;
+	intptr_t mapping = 0;
+	Buffer::word_t* view = nullptr;
+	size_t length = 0;
+	bool writable = false;
+
+	void map();
+
+	void unmap();
+
+public:
+	// region ctor/dtor
+
+	/**
+	 * \brief Opens an existing file for reading or creates an empty one for writing.
+	 */
+	MappedFile(std::string const& path, bool writable);
+
+	MappedFile(MappedFile const&) = delete;
+
+	MappedFile& operator=(MappedFile const&) = delete;
+
+	~MappedFile();
+
+	// endregion
+
+	void resize(size_t new_length);
+
+	/**
+	 * \brief Unmaps the file and cuts it down to [new_length] bytes.
+	 */
+	void close(size_t new_length);
+
+	Buffer::word_t* data() const;
+
+	size_t size() const;
+};
+}	 // namespace detail
+
+/**
+ * \brief Packages which went through a wire, as written by [WireRecorder].
+ *
+ * Layout: "RDWR" magic and int32 version, then one record per package:
+ * int64 nanoseconds since the recording started, uint8 direction, int64 id, int32 size and the payload.
+ * The payload is what the entity writes or reads, context and length prefixes of the wire aren't included.
+ */
+class RD_FRAMEWORK_API WireRecording
+{
+public:
+	enum class Direction : uint8_t
+	{
+		Sent,
+		Received
+	};
+
+	struct Package
+	{
+		std::chrono::nanoseconds timestamp;
+		Direction direction;
+		RdId id;
+		Buffer::word_t const* data;
+		int32_t size;
+	};
+
+	static constexpr char MAGIC[4] = {'R', 'D', 'W', 'R'};
+	static constexpr int32_t VERSION = 1;
+	static constexpr size_t HEADER_SIZE = sizeof(MAGIC) + sizeof(VERSION);
+	static constexpr size_t RECORD_HEADER_SIZE = sizeof(int64_t) + sizeof(Direction) + sizeof(RdId::hash_t) + sizeof(int32_t);
+
+private:
+	detail::MappedFile file;
+
+	std::vector<Package> packages;
+
+public:
+	// region ctor/dtor
+
+	explicit WireRecording(std::string const& path);
+
+	// endregion
+
+	/**
+	 * \brief Packages in the order they were recorded, pointing into the mapped file.
+	 */
+	std::vector<Package> const& get_packages() const;
+};
+
+/**
+ * \brief Appends packages to a recording which can be read by [WireRecording].
+ *
+ * Records are copied straight into the mapped file, which is grown twice when it runs out of space
+ * and truncated to the written size on destruction.
+ */
+class RD_FRAMEWORK_API WireRecorder
+{
+	std::mutex lock;
+
+	detail::MappedFile file;
+
+	size_t used = 0;
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+public:
+	// region ctor/dtor
+
+	explicit WireRecorder(std::string const& path, size_t initial_capacity = 1u << 24);
+
+	~WireRecorder();
+
+	// endregion
+
+	void record(WireRecording::Direction direction, RdId const& id, Buffer::word_t const* data, size_t size);
+
+	/**
+	 * \brief Number of bytes written so far, including the header.
+	 */
+	size_t get_size();
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_WIRERECORDING_H
@@ -1 +1,230 @@
 #include "RdTextBuffer.h"
+
+#include "base/IWire.h"
+#include "protocol/Buffer.h"
+
+#include "spdlog/spdlog.h"
+
+namespace rd
+{
+std::string to_string(RdTextChange const& value)
+{
+	return "offset = " + std::to_string(value.offset) + ", deleted = " + std::to_string(value.deleted_length) +
+		   ", inserted = " + std::to_string(value.inserted.size()) + " chars";
+}
+
+RdTextBuffer::RdTextBuffer(wstring_view initial_text) : text(initial_text)
+{
+}
+
+RdTextBuffer RdTextBuffer::read(SerializationCtx& /*ctx*/, Buffer& buffer)
+{
+	RdTextBuffer res;
+	const RdId& id = RdId::read(buffer);
+	withId(res, id);
+	return res;
+}
+
+void RdTextBuffer::write(SerializationCtx& /*ctx*/, Buffer& buffer) const
+{
+	rdid.write(buffer);
+}
+
+void RdTextBuffer::init(Lifetime lifetime) const
+{
+	RdReactiveBase::init(lifetime);
+	get_wire()->advise(lifetime, this);
+
+	// text set before binding goes as the first edit
+	if (text.length() > 0)
+	{
+		local_change([this] {
+			RdTextChange change{0, 0, text.to_wstring()};
+			if (is_master)
+			{
+				++master_version;
+			}
+			else
+			{
+				unconfirmed.push_back({++slave_version, 0, static_cast<int32_t>(change.inserted.size()), {}});
+			}
+			send(Kind::CHANGE, &change);
+		});
+	}
+}
+
+std::wstring RdTextBuffer::apply(RdTextChange const& change) const
+{
+	std::wstring removed = text.remove(change.offset, change.deleted_length);
+	text.insert(change.offset, change.inserted);
+	changes.fire(change);
+	return removed;
+}
+
+void RdTextBuffer::send(Kind kind, RdTextChange const* change) const
+{
+	get_wire()->send(rdid, [this, kind, change](Buffer& buffer) {
+		buffer.write_integral<int32_t>(static_cast<int32_t>(kind) | ((is_master ? 1 : 0) << masterFlagShift));
+		buffer.write_integral<int32_t>(master_version);
+		buffer.write_integral<int32_t>(slave_version);
+		if (change)
+		{
+			buffer.write_integral<int32_t>(change->offset);
+			buffer.write_integral<int32_t>(change->deleted_length);
+			buffer.write_wstring(change->inserted);
+			RD_LOG_TRACE(logSend, "SEND text {} {}:: master = {}, slave = {}, {}", to_string(location), to_string(rdid),
+				master_version, slave_version, to_string(*change));
+		}
+	});
+}
+
+void RdTextBuffer::confirm(int32_t version) const
+{
+	while (!unconfirmed.empty() && unconfirmed.front().slave_version <= version)
+	{
+		unconfirmed.pop_front();
+	}
+}
+
+void RdTextBuffer::roll_back(int32_t version) const
+{
+	while (!unconfirmed.empty() && unconfirmed.back().slave_version > version)
+	{
+		Unconfirmed& edit = unconfirmed.back();
+		RD_LOG_TRACE(logReceived, "text {} {}:: slave edit {} is rejected by master, rolling back", to_string(location),
+			to_string(rdid), edit.slave_version);
+		apply(RdTextChange{edit.offset, edit.inserted_length, std::move(edit.removed)});
+		unconfirmed.pop_back();
+	}
+}
+
+bool RdTextBuffer::is_valid(RdTextChange const& change) const
+{
+	return change.offset >= 0 && change.deleted_length >= 0 && static_cast<size_t>(change.offset) <= text.length() &&
+		   static_cast<size_t>(change.deleted_length) <= text.length() - change.offset;
+}
+
+void RdTextBuffer::on_wire_received(Buffer buffer) const
+{
+	const int32_t header = buffer.read_integral<int32_t>();
+	const bool from_master = (header >> masterFlagShift) != 0;
+	const auto kind = static_cast<Kind>(header & ((1 << masterFlagShift) - 1));
+	const int32_t remote_master_version = buffer.read_integral<int32_t>();
+	const int32_t remote_slave_version = buffer.read_integral<int32_t>();
+
+	if (kind == Kind::ACK)
+	{
+		if (is_master)
+		{
+			logReceived->error("text {} {}:: received ACK when a master", to_string(location), to_string(rdid));
+			return;
+		}
+		confirm(remote_slave_version);
+		return;
+	}
+
+	RdTextChange change;
+	change.offset = buffer.read_integral<int32_t>();
+	change.deleted_length = buffer.read_integral<int32_t>();
+	change.inserted = buffer.read_wstring();
+	RD_LOG_TRACE(logReceived, "RECV text {} {}:: master = {}, slave = {}, {}", to_string(location), to_string(rdid),
+		remote_master_version, remote_slave_version, to_string(change));
+	if (from_master == is_master)
+	{
+		logReceived->error("Both ends are {}: {}", is_master ? "masters" : "slaves", to_string(location));
+	}
+
+	if (is_master)
+	{
+		if (remote_master_version != master_version)
+		{
+			// made on a text without our latest edits, slave rolls it back once it sees them
+			RD_LOG_TRACE(logReceived, "text {} {}:: slave edit {} >> REJECTED", to_string(location), to_string(rdid),
+				remote_slave_version);
+			return;
+		}
+		slave_version = remote_slave_version;
+	}
+	else
+	{
+		// master has seen our edits up to [remote_slave_version] and applied its edit on top of them
+		roll_back(remote_slave_version);
+		confirm(remote_slave_version);
+		slave_version = remote_slave_version;
+		master_version = remote_master_version;
+	}
+
+	if (!is_valid(change))
+	{
+		logReceived->error("text {} {}:: {} doesn't fit text of length {}", to_string(location), to_string(rdid),
+			to_string(change), text.length());
+		return;
+	}
+	apply(change);
+
+	if (is_master)
+	{
+		send(Kind::ACK, nullptr);
+	}
+}
+
+size_t RdTextBuffer::length() const
+{
+	return text.length();
+}
+
+std::wstring RdTextBuffer::get_text() const
+{
+	return text.to_wstring();
+}
+
+std::wstring RdTextBuffer::substr(size_t offset, size_t count) const
+{
+	return text.substr(offset, count);
+}
+
+void RdTextBuffer::insert(size_t offset, wstring_view inserted) const
+{
+	replace(offset, 0, inserted);
+}
+
+void RdTextBuffer::remove(size_t offset, size_t count) const
+{
+	replace(offset, count, wstring_view());
+}
+
+void RdTextBuffer::replace(size_t offset, size_t count, wstring_view inserted) const
+{
+	local_change([&] {
+		RdTextChange change{static_cast<int32_t>(offset), static_cast<int32_t>(count), std::wstring(inserted.data(), inserted.size())};
+		std::wstring removed = apply(change);
+		if (!is_bound())
+		{
+			return;
+		}
+		if (is_master)
+		{
+			++master_version;
+		}
+		else
+		{
+			unconfirmed.push_back({++slave_version, change.offset, static_cast<int32_t>(change.inserted.size()), std::move(removed)});
+		}
+		send(Kind::CHANGE, &change);
+	});
+}
+
+void RdTextBuffer::advise(Lifetime lifetime, std::function<void(RdTextChange const&)> handler) const
+{
+	if (is_bound())
+	{
+		assert_threading();
+	}
+	changes.advise(lifetime, std::move(handler));
+}
+
+std::string to_string(RdTextBuffer const& value)
+{
+	return "RdTextBuffer: " + std::to_string(value.length()) + " chars";
+}
+}	 // namespace rd
\ No newline at end of file
@@ -1,11 +1,141 @@
 #ifndef RD_CPP_RDTEXTBUFFER_H
 #define RD_CPP_RDTEXTBUFFER_H
 
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#pragma warning(disable:4250)
+#endif
+
+#include "base/RdReactiveBase.h"
+#include "serialization/ISerializable.h"
+#include "reactive/base/SignalX.h"
+#include "TextRope.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+
+#include <rd_framework_export.h>
+
 namespace rd
 {
-class RdTextBuffer
+/**
+ * \brief Edit of [RdTextBuffer]: [deleted_length] chars at [offset] are replaced with [inserted].
+ */
+struct RD_FRAMEWORK_API RdTextChange
 {
+	int32_t offset = 0;
+	int32_t deleted_length = 0;
+	std::wstring inserted;
+
+	friend std::string to_string(RdTextChange const& value);
+};
+
+/**
+ * \brief Text shared by both sides of the protocol which is synchronized by sending edits only.
+ *
+ * Both sides may edit concurrently, conflicts are resolved in favour of [is_master] side like in [RdMap].
+ * Every edit carries versions of both sides the editor has seen. Master rejects a slave edit made before
+ * the latest master edit was seen and acknowledges the accepted ones. Slave keeps its unacknowledged edits
+ * until then and rolls back those master didn't see when the next master edit comes.
+ */
+class RD_FRAMEWORK_API RdTextBuffer final : public RdReactiveBase, public ISerializable
+{
+	enum class Kind : int32_t
+	{
+		CHANGE,
+		ACK
+	};
+
+	static const int32_t masterFlagShift = 8;
+
+	/**
+	 * \brief Local edit of slave side which master hasn't acknowledged yet.
+	 */
+	struct Unconfirmed
+	{
+		int32_t slave_version;
+		int32_t offset;
+		int32_t inserted_length;
+		std::wstring removed;
+	};
+
+	mutable TextRope text;
+	Signal<RdTextChange> changes;
+
+	mutable int32_t master_version = 0;
+	mutable int32_t slave_version = 0;
+	mutable std::deque<Unconfirmed> unconfirmed;
+
+	/**
+	 * \return removed text
+	 */
+	std::wstring apply(RdTextChange const& change) const;
+
+	void send(Kind kind, RdTextChange const* change) const;
+
+	/**
+	 * \brief Forgets slave edits up to [version], they are accepted by master.
+	 */
+	void confirm(int32_t version) const;
+
+	/**
+	 * \brief Undoes slave edits after [version], master hasn't seen them and rejects them.
+	 */
+	void roll_back(int32_t version) const;
+
+	bool is_valid(RdTextChange const& change) const;
+
+public:
+	bool is_master = false;
+
+	// region ctor/dtor
+
+	RdTextBuffer() = default;
+
+	explicit RdTextBuffer(wstring_view initial_text);
+
+	RdTextBuffer(RdTextBuffer&&) = default;
+
+	RdTextBuffer& operator=(RdTextBuffer&&) = default;
+
+	virtual ~RdTextBuffer() = default;
+	// endregion
+
+	static RdTextBuffer read(SerializationCtx& ctx, Buffer& buffer);
+
+	void write(SerializationCtx& ctx, Buffer& buffer) const override;
+
+	void init(Lifetime lifetime) const override;
+
+	void on_wire_received(Buffer buffer) const override;
+
+	size_t length() const;
+
+	std::wstring get_text() const;
+
+	std::wstring substr(size_t offset, size_t count) const;
+
+	void insert(size_t offset, wstring_view inserted) const;
+
+	void remove(size_t offset, size_t count) const;
+
+	/**
+	 * \brief Replaces [count] chars at [offset] with [inserted] as a single edit.
+	 */
+	void replace(size_t offset, size_t count, wstring_view inserted) const;
+
+	/**
+	 * \brief [handler] is called for every edit, local and remote ones, including roll backs of rejected local edits.
+	 */
+	void advise(Lifetime lifetime, std::function<void(RdTextChange const&)> handler) const;
+
+	friend std::string to_string(RdTextBuffer const& value);
 };
 }	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
 
 #endif	  // RD_CPP_RDTEXTBUFFER_H
@@ -0,0 +1,152 @@
+#include "TextRope.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace rd
+{
+constexpr size_t TextRope::CHUNK_SIZE;
+
+TextRope::TextRope(wstring_view text)
+{
+	insert(0, text);
+}
+
+std::pair<size_t, size_t> TextRope::locate(size_t offset) const
+{
+	for (size_t i = 0; i < chunks.size(); ++i)
+	{
+		if (offset <= chunks[i].size())
+		{
+			return {i, offset};
+		}
+		offset -= chunks[i].size();
+	}
+	return {chunks.size(), 0};
+}
+
+void TextRope::check_range(size_t offset, size_t count) const
+{
+	if (offset > total || count > total - offset)
+	{
+		throw std::out_of_range(
+			"Range [" + std::to_string(offset) + ", " + std::to_string(offset + count) + ") is out of text of length " + std::to_string(total));
+	}
+}
+
+void TextRope::split(size_t index)
+{
+	std::wstring big = std::move(chunks[index]);
+	std::vector<std::wstring> parts;
+	for (size_t from = 0; from < big.size(); from += CHUNK_SIZE)
+	{
+		parts.push_back(big.substr(from, CHUNK_SIZE));
+	}
+	chunks[index] = std::move(parts.front());
+	chunks.insert(chunks.begin() + index + 1, std::make_move_iterator(parts.begin() + 1), std::make_move_iterator(parts.end()));
+}
+
+void TextRope::merge(size_t index)
+{
+	while (index + 1 < chunks.size() && chunks[index].size() + chunks[index + 1].size() <= CHUNK_SIZE)
+	{
+		chunks[index] += chunks[index + 1];
+		chunks.erase(chunks.begin() + index + 1);
+	}
+	while (index > 0 && chunks[index - 1].size() + chunks[index].size() <= CHUNK_SIZE)
+	{
+		chunks[index - 1] += chunks[index];
+		chunks.erase(chunks.begin() + index);
+		--index;
+	}
+}
+
+size_t TextRope::length() const
+{
+	return total;
+}
+
+void TextRope::insert(size_t offset, wstring_view text)
+{
+	check_range(offset, 0);
+	if (text.empty())
+	{
+		return;
+	}
+	if (chunks.empty())
+	{
+		chunks.emplace_back();
+	}
+
+	auto location = locate(offset);
+	std::wstring& chunk = chunks[location.first];
+	chunk.insert(location.second, text.data(), text.size());
+	total += text.size();
+	if (chunk.size() > 2 * CHUNK_SIZE)
+	{
+		split(location.first);
+	}
+}
+
+std::wstring TextRope::remove(size_t offset, size_t count)
+{
+	check_range(offset, count);
+	std::wstring removed;
+	if (count == 0)
+	{
+		return removed;
+	}
+	removed.reserve(count);
+
+	auto location = locate(offset);
+	size_t index = location.first;
+	size_t position = location.second;
+	size_t left = count;
+	while (left > 0)
+	{
+		std::wstring& chunk = chunks[index];
+		const size_t n = (std::min)(left, chunk.size() - position);
+		removed.append(chunk, position, n);
+		chunk.erase(position, n);
+		left -= n;
+		if (chunk.empty())
+		{
+			chunks.erase(chunks.begin() + index);
+		}
+		else if (left > 0)
+		{
+			++index;
+		}
+		position = 0;
+	}
+	total -= count;
+	// the chunk the removal started in might have become small
+	if (!chunks.empty())
+	{
+		merge((std::min)(location.first, chunks.size() - 1));
+	}
+	return removed;
+}
+
+std::wstring TextRope::substr(size_t offset, size_t count) const
+{
+	check_range(offset, count);
+	std::wstring result;
+	result.reserve(count);
+
+	auto location = locate(offset);
+	size_t position = location.second;
+	for (size_t i = location.first; result.size() < count; ++i)
+	{
+		result.append(chunks[i], position, count - result.size());
+		position = 0;
+	}
+	return result;
+}
+
+std::wstring TextRope::to_wstring() const
+{
+	return substr(0, total);
+}
+}	 // namespace rd
\ No newline at end of file
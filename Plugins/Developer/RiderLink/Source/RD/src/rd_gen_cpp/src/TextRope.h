@@ -0,0 +1,79 @@
+#ifndef RD_CPP_TEXTROPE_H
+#define RD_CPP_TEXTROPE_H
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+
+#include "thirdparty.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <rd_framework_export.h>
+
+namespace rd
+{
+/**
+ * \brief Text storage for large documents edited in small pieces.
+ *
+ * Text is kept in a sequence of chunks of roughly [CHUNK_SIZE] chars, so an edit moves at most a couple of chunks
+ * instead of the whole tail of the document, and finding a chunk is a scan over chunk lengths only.
+ */
+class RD_FRAMEWORK_API TextRope
+{
+public:
+	static constexpr size_t CHUNK_SIZE = 4096;
+
+private:
+	std::vector<std::wstring> chunks;
+	size_t total = 0;
+
+	/**
+	 * \return index of the chunk containing [offset] and position in it, the end of a chunk is preferred over
+	 * the start of the next one
+	 */
+	std::pair<size_t, size_t> locate(size_t offset) const;
+
+	void check_range(size_t offset, size_t count) const;
+
+	/**
+	 * \brief Cuts the chunk at [index] into chunks of [CHUNK_SIZE].
+	 */
+	void split(size_t index);
+
+	/**
+	 * \brief Glues the chunk at [index] to its neighbours while they fit into one chunk.
+	 */
+	void merge(size_t index);
+
+public:
+	// region ctor/dtor
+
+	TextRope() = default;
+
+	explicit TextRope(wstring_view text);
+	// endregion
+
+	size_t length() const;
+
+	void insert(size_t offset, wstring_view text);
+
+	/**
+	 * \return removed text
+	 */
+	std::wstring remove(size_t offset, size_t count);
+
+	std::wstring substr(size_t offset, size_t count) const;
+
+	std::wstring to_wstring() const;
+};
+}	 // namespace rd
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#endif	  // RD_CPP_TEXTROPE_H
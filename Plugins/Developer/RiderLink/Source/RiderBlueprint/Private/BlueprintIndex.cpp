@@ -0,0 +1,177 @@
+#include "BlueprintIndex.hpp"
+
+#include "AssetData.h"
+#include "AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+
+namespace BlueprintIndexImpl
+{
+struct FEntry
+{
+    FName ObjectPath;
+    FName PackageName;
+    FName GeneratedClassPath;
+};
+
+static FEntry MakeEntry(const FAssetData& AssetData)
+{
+    FEntry Entry{AssetData.ObjectPath, AssetData.PackageName, NAME_None};
+    FString GeneratedClass;
+    if (AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClass))
+    {
+        Entry.GeneratedClassPath = FName(*FPackageName::ExportTextPathToObjectPath(GeneratedClass));
+    }
+    return Entry;
+}
+
+static void AddEntry(TMap<FName, FName>& ObjectPaths, const FEntry& Entry)
+{
+    ObjectPaths.Add(Entry.ObjectPath, Entry.ObjectPath);
+    ObjectPaths.Add(Entry.PackageName, Entry.ObjectPath);
+    if (!Entry.GeneratedClassPath.IsNone())
+    {
+        ObjectPaths.Add(Entry.GeneratedClassPath, Entry.ObjectPath);
+    }
+}
+
+static void RemoveEntry(TMap<FName, FName>& ObjectPaths, const FEntry& Entry)
+{
+    // keys which were taken over by another asset stay
+    for (const FName Key : {Entry.ObjectPath, Entry.PackageName, Entry.GeneratedClassPath})
+    {
+        const FName* ObjectPath = ObjectPaths.Find(Key);
+        if (ObjectPath && *ObjectPath == Entry.ObjectPath)
+        {
+            ObjectPaths.Remove(Key);
+        }
+    }
+}
+}
+
+void FBlueprintIndex::Start(IAssetRegistry& AssetRegistry)
+{
+    OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FBlueprintIndex::Add);
+    OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FBlueprintIndex::Remove);
+    OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FBlueprintIndex::Rename);
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        OnFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddLambda([this, &AssetRegistry]()
+        {
+            Build(AssetRegistry);
+        });
+    }
+    else
+    {
+        Build(AssetRegistry);
+    }
+}
+
+void FBlueprintIndex::Stop(IAssetRegistry& AssetRegistry)
+{
+    AssetRegistry.OnFilesLoaded().Remove(OnFilesLoadedHandle);
+    AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+    AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+    AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+
+    FWriteScopeLock WriteLock(Lock);
+    bReady.store(false, std::memory_order_release);
+    ObjectPaths.Empty();
+    BlueprintClasses.Empty();
+    BumpGeneration();
+}
+
+FName FBlueprintIndex::Find(const FString& Path) const
+{
+    // a sub-object is found through the asset which contains it
+    int32 Len;
+    if (!Path.FindChar(TEXT(':'), Len))
+    {
+        Len = Path.Len();
+    }
+    if (Len == 0 || Len >= NAME_SIZE) return NAME_None;
+
+    // FNAME_Find doesn't add names, and every path in the index is a name already
+    const FName Key(Len, *Path, FNAME_Find);
+    if (Key.IsNone()) return NAME_None;
+
+    FReadScopeLock ReadLock(Lock);
+    const FName* ObjectPath = ObjectPaths.Find(Key);
+    return ObjectPath ? *ObjectPath : NAME_None;
+}
+
+void FBlueprintIndex::Build(IAssetRegistry& AssetRegistry)
+{
+    const FName BlueprintClass = UBlueprint::StaticClass()->GetFName();
+    TSet<FName> Classes;
+    AssetRegistry.GetDerivedClassNames({BlueprintClass}, {}, Classes);
+    Classes.Add(BlueprintClass);
+
+    FARFilter Filter;
+    Filter.ClassNames = Classes.Array();
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(Filter, Assets);
+
+    // making names of generated classes is most of the work, the map is filled on this thread afterwards
+    TArray<BlueprintIndexImpl::FEntry> Entries;
+    Entries.SetNum(Assets.Num());
+    ParallelFor(Assets.Num(), [&Assets, &Entries](int32 Index)
+    {
+        Entries[Index] = BlueprintIndexImpl::MakeEntry(Assets[Index]);
+    });
+
+    FWriteScopeLock WriteLock(Lock);
+    BlueprintClasses = MoveTemp(Classes);
+    ObjectPaths.Reset();
+    ObjectPaths.Reserve(Entries.Num() * 3);
+    for (const BlueprintIndexImpl::FEntry& Entry : Entries)
+    {
+        BlueprintIndexImpl::AddEntry(ObjectPaths, Entry);
+    }
+    bReady.store(true, std::memory_order_release);
+    BumpGeneration();
+}
+
+void FBlueprintIndex::Add(const FAssetData& AssetData)
+{
+    // assets found by the initial scan are indexed by Build
+    if (!IsReady() || !IsBlueprintAsset(AssetData)) return;
+
+    const BlueprintIndexImpl::FEntry Entry = BlueprintIndexImpl::MakeEntry(AssetData);
+    FWriteScopeLock WriteLock(Lock);
+    BlueprintIndexImpl::AddEntry(ObjectPaths, Entry);
+    BumpGeneration();
+}
+
+void FBlueprintIndex::Remove(const FAssetData& AssetData)
+{
+    if (!IsReady() || !IsBlueprintAsset(AssetData)) return;
+
+    const BlueprintIndexImpl::FEntry Entry = BlueprintIndexImpl::MakeEntry(AssetData);
+    FWriteScopeLock WriteLock(Lock);
+    BlueprintIndexImpl::RemoveEntry(ObjectPaths, Entry);
+    BumpGeneration();
+}
+
+void FBlueprintIndex::Rename(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (!IsReady() || !IsBlueprintAsset(AssetData)) return;
+
+    // tags of the old asset are gone, its generated class is named the usual way
+    const BlueprintIndexImpl::FEntry OldEntry{
+        FName(*OldObjectPath),
+        FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)),
+        FName(*(OldObjectPath + TEXT("_C")), FNAME_Find)};
+    const BlueprintIndexImpl::FEntry Entry = BlueprintIndexImpl::MakeEntry(AssetData);
+    FWriteScopeLock WriteLock(Lock);
+    BlueprintIndexImpl::RemoveEntry(ObjectPaths, OldEntry);
+    BlueprintIndexImpl::AddEntry(ObjectPaths, Entry);
+    BumpGeneration();
+}
+
+bool FBlueprintIndex::IsBlueprintAsset(const FAssetData& AssetData) const
+{
+    // BlueprintClasses is only written by Build on this thread
+    return BlueprintClasses.Contains(AssetData.AssetClass);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "Delegates/IDelegateInstance.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/NameTypes.h"
+
+#include <atomic>
+
+struct FAssetData;
+class IAssetRegistry;
+
+/**
+ * Blueprint assets known to the asset registry, found by object path, package name or generated class path.
+ * Built once the registry finishes its initial scan and kept up to date by its add, remove and rename events,
+ * so answering whether a path is a blueprint never loads a package.
+ * Updated on the game thread, looked up from any thread.
+ */
+class FBlueprintIndex
+{
+public:
+    void Start(IAssetRegistry& AssetRegistry);
+    void Stop(IAssetRegistry& AssetRegistry);
+
+    /** False until the initial scan of the registry has been indexed */
+    bool IsReady() const { return bReady.load(std::memory_order_acquire); }
+
+    /** Object path of the blueprint Path refers to, NAME_None if it doesn't refer to one */
+    FName Find(const FString& Path) const;
+
+    /** Changes every time the index does, answers remembered at an older generation may be stale */
+    uint32 GetGeneration() const { return Generation.load(std::memory_order_acquire); }
+
+private:
+    void Build(IAssetRegistry& AssetRegistry);
+    void Add(const FAssetData& AssetData);
+    void Remove(const FAssetData& AssetData);
+    void Rename(const FAssetData& AssetData, const FString& OldObjectPath);
+    bool IsBlueprintAsset(const FAssetData& AssetData) const;
+    void BumpGeneration() { Generation.fetch_add(1, std::memory_order_release); }
+
+    mutable FRWLock Lock;
+    /** Every name a blueprint is known by, mapped to its object path */
+    TMap<FName, FName> ObjectPaths;
+    /** UBlueprint and the classes derived from it */
+    TSet<FName> BlueprintClasses;
+    std::atomic<bool> bReady{false};
+    std::atomic<uint32> Generation{0};
+
+    FDelegateHandle OnFilesLoadedHandle;
+    FDelegateHandle OnAssetAddedHandle;
+    FDelegateHandle OnAssetRemovedHandle;
+    FDelegateHandle OnAssetRenamedHandle;
+};
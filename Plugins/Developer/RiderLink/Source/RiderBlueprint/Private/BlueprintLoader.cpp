@@ -0,0 +1,106 @@
+#include "BlueprintLoader.hpp"
+
+#include "BlueprintIndex.hpp"
+
+#include "AssetRegistryModule.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+static UObject* FindLoadedAsset(UPackage* Package, const FString& AssetName)
+{
+    UObject* Object = FindObject<UObject>(Package, *AssetName);
+    return Object && !Object->HasAnyFlags(RF_NeedLoad) ? Object : nullptr;
+}
+
+void FBlueprintLoader::Open(const FString& AssetPathName)
+{
+    const FString PackageName = FPackageName::ObjectPathToPackageName(AssetPathName);
+    const FString AssetName = FPaths::GetBaseFilename(AssetPathName);
+
+    // nothing to wait for if the blueprint is open already or was prefetched
+    if (UPackage* Package = FindPackage(nullptr, *PackageName))
+    {
+        if (FindLoadedAsset(Package, AssetName))
+        {
+            OnLoaded(AssetName, Package);
+            return;
+        }
+    }
+
+    PendingPackages.Add(FName(*PackageName));
+    LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda(
+        [this, AssetName](const FName& LoadedPackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+        {
+            PendingPackages.Remove(LoadedPackageName);
+            if (Result == EAsyncLoadingResult::Succeeded && Package != nullptr)
+            {
+                OnLoaded(AssetName, Package);
+            }
+        }), OpenPriority);
+}
+
+void FBlueprintLoader::ReleasePrefetched()
+{
+    PrefetchedPackages.Empty();
+}
+
+void FBlueprintLoader::OnLoaded(const FString& AssetName, UPackage* Package)
+{
+    // the editor references the blueprint from now on
+    PrefetchedPackages.Remove(Package->GetFName());
+    if (UObject* Object = FindLoadedAsset(Package, AssetName))
+    {
+        FKismetEditorUtilities::BringKismetToFocusAttentionOnObject(Object);
+    }
+    Prefetch(Package->GetFName());
+}
+
+void FBlueprintLoader::Prefetch(FName PackageName)
+{
+    const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+        AssetRegistryConstants::ModuleName).Get();
+    TArray<FName> Dependencies;
+    AssetRegistry.GetDependencies(PackageName, Dependencies);
+
+    int32 NumPrefetched = 0;
+    for (const FName Dependency : Dependencies)
+    {
+        if (NumPrefetched == MaxPrefetchesPerOpen) return;
+
+        const FString DependencyName = Dependency.ToString();
+        if (BlueprintIndex.Find(DependencyName).IsNone()) continue;
+        if (PendingPackages.Contains(Dependency) || FindPackage(nullptr, *DependencyName)) continue;
+        if (!RememberRequest(Dependency)) continue;
+
+        PendingPackages.Add(Dependency);
+        LoadPackageAsync(DependencyName, FLoadPackageAsyncDelegate::CreateLambda(
+            [this](const FName& LoadedPackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+            {
+                PendingPackages.Remove(LoadedPackageName);
+                // the request may have been evicted while it was loading, nothing would release the package then
+                if (Result == EAsyncLoadingResult::Succeeded && Package != nullptr &&
+                    RecentPackages.Contains(LoadedPackageName))
+                {
+                    PrefetchedPackages.Add(LoadedPackageName, TStrongObjectPtr<UPackage>(Package));
+                }
+            }));
+        ++NumPrefetched;
+    }
+}
+
+bool FBlueprintLoader::RememberRequest(FName PackageName)
+{
+    if (RecentPackages.Contains(PackageName)) return false;
+
+    if (RecentPackages.Num() == MaxRecentPackages)
+    {
+        PrefetchedPackages.Remove(RecentPackages[0]);
+        RecentPackages.RemoveAt(0);
+    }
+    RecentPackages.Add(PackageName);
+    return true;
+}
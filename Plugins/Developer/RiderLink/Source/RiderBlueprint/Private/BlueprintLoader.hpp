@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+#include "UObject/StrongObjectPtr.h"
+
+class FBlueprintIndex;
+class UPackage;
+
+/**
+ * Opens blueprints in their editor without blocking the game thread on package loads.
+ * The package is streamed in by the async loader and the editor is focused from its completion callback.
+ * Blueprints referenced by recently opened ones are prefetched at a lower priority, so following a reference is instant.
+ * Prefetched packages are kept from GC until they are opened or drop out of the recent requests.
+ * Game thread only.
+ */
+class FBlueprintLoader
+{
+public:
+    explicit FBlueprintLoader(const FBlueprintIndex& InBlueprintIndex) : BlueprintIndex(InBlueprintIndex) {}
+
+    void Open(const FString& AssetPathName);
+
+    /** Lets GC collect the prefetched packages, has to be called before UObjects shut down */
+    void ReleasePrefetched();
+
+private:
+    static constexpr int32 OpenPriority = 100;
+    static constexpr int32 MaxPrefetchesPerOpen = 8;
+    static constexpr int32 MaxRecentPackages = 64;
+
+    void OnLoaded(const FString& AssetName, UPackage* Package);
+    void Prefetch(FName PackageName);
+    /** False if the package was requested recently already */
+    bool RememberRequest(FName PackageName);
+
+    const FBlueprintIndex& BlueprintIndex;
+    /** Oldest first */
+    TArray<FName> RecentPackages;
+    TSet<FName> PendingPackages;
+    /** Nothing references a prefetched package until it is opened */
+    TMap<FName, TStrongObjectPtr<UPackage>> PrefetchedPackages;
+};
@@ -1,34 +1,67 @@
 #include "BlueprintProvider.hpp"
 
+#include "BlueprintIndex.hpp"
+#include "BlueprintLoader.hpp"
+
 #include "Async/Async.h"
 #include "AssetData.h"
 #include "AssetEditorMessages.h"
 #include "BlueprintEditor.h"
 #include "MessageEndpointBuilder.h"
 #include "MessageEndpoint.h"
-#include "Kismet2/KismetEditorUtilities.h"
 #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION <= 23
 #include "Toolkits/AssetEditorManager.h"
 #endif
 
 #include "Runtime/Launch/Resources/Version.h"
 
-void BluePrintProvider::AddAsset(FAssetData const& AssetData) {
-#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION <= 23
-    UObject* cls = AssetData.GetAsset();
-#else
-    UObject* cls = AssetData.FastGetAsset();
+static FBlueprintIndex& GetBlueprintIndex() {
+    static FBlueprintIndex BlueprintIndex;
+    return BlueprintIndex;
+}
+
+#if !(ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION <= 23)
+static FBlueprintLoader& GetBlueprintLoader() {
+    static FBlueprintLoader BlueprintLoader(GetBlueprintIndex());
+    return BlueprintLoader;
+}
 #endif
-    if (cls) {
-        UBlueprint* Blueprint = Cast<UBlueprint>(cls);
-        if (Blueprint && Blueprint->IsValidLowLevel()) {
 
-        }
-    }
+void BluePrintProvider::StartIndexing(IAssetRegistry& AssetRegistry) {
+    GetBlueprintIndex().Start(AssetRegistry);
+}
+
+void BluePrintProvider::StopIndexing(IAssetRegistry& AssetRegistry) {
+    GetBlueprintIndex().Stop(AssetRegistry);
+}
+
+void BluePrintProvider::ReleaseLoadedPackages() {
+#if !(ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION <= 23)
+    GetBlueprintLoader().ReleasePrefetched();
+#endif
 }
 
 bool BluePrintProvider::IsBlueprint(FString const& pathName) {
-    return FPackageName::IsValidObjectPath(pathName);
+    const FBlueprintIndex& BlueprintIndex = GetBlueprintIndex();
+    // Until the registry has been scanned the syntax is all there is to check
+    if (!BlueprintIndex.IsReady())
+        return FPackageName::IsValidObjectPath(pathName);
+
+    return !BlueprintIndex.Find(pathName).IsNone();
+}
+
+uint32 BluePrintProvider::GetIndexGeneration() {
+    return GetBlueprintIndex().GetGeneration();
+}
+
+TOptional<FString> BluePrintProvider::GetPathNameByPath(FString const& path) {
+    FName ObjectPath = GetBlueprintIndex().Find(path);
+    FString PackageName;
+    if (ObjectPath.IsNone() && FPackageName::TryConvertFilenameToLongPackageName(path, PackageName))
+        ObjectPath = GetBlueprintIndex().Find(PackageName);
+
+    if (ObjectPath.IsNone()) return {};
+    return ObjectPath.ToString();
 }
 
 void BluePrintProvider::OpenBlueprint(FString const& AssetPathName, TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> const& messageEndpoint) {
@@ -39,18 +72,7 @@ void BluePrintProvider::OpenBlueprint(FString const& AssetPathName, TSharedPtr<F
 #else
     AsyncTask(ENamedThreads::GameThread, [AssetPathName]()
     {
-        // An asset needs loading
-        UPackage* Package = LoadPackage(nullptr, *AssetPathName, LOAD_NoRedirects);
-
-        if (Package)
-        {
-            Package->FullyLoad();
-
-            FString AssetName = FPaths::GetBaseFilename(AssetPathName);
-            UObject* Object = FindObject<UObject>(Package, *AssetName);
-            if(Object != nullptr)
-                FKismetEditorUtilities::BringKismetToFocusAttentionOnObject(Object);
-        }
+        GetBlueprintLoader().Open(AssetPathName);
     });
 #endif
 }
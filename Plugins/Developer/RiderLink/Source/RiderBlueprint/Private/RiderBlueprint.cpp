@@ -5,6 +5,7 @@
 #include "Model/RdEditorProtocol/RdEditorModel/RdEditorModel.Generated.h"
 
 #include "AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "Engine/Blueprint.h"
 #include "Framework/Docking/TabManager.h"
 #include "HAL/PlatformProcess.h"
@@ -42,51 +43,65 @@ void FRiderBlueprintModule::StartupModule()
     IRiderLinkModule& RiderLinkModule = IRiderLinkModule::Get();
     ModuleLifetimeDef = RiderLinkModule.CreateNestedLifetimeDefinition();
 
-    const FAssetRegistryModule* AssetRegistryModule = &FModuleManager::LoadModuleChecked<FAssetRegistryModule>
-        (AssetRegistryConstants::ModuleName);
+    // the registry scan and the index only serve Rider, so they wait for it to connect
+    RiderLinkModule.StartWhenConnected(ModuleLifetimeDef.lifetime, [this, Lifetime = ModuleLifetimeDef.lifetime]()
+    {
+        // the asset registry is used on the game thread
+        AsyncTask(ENamedThreads::GameThread, [this, Lifetime]()
+        {
+            if (Lifetime->is_terminated()) return;
 
-    MessageEndpoint = FMessageEndpoint::Builder(FName("FAssetEditorManager")).Build();
+            const FAssetRegistryModule* AssetRegistryModule = &FModuleManager::LoadModuleChecked<FAssetRegistryModule>
+                (AssetRegistryConstants::ModuleName);
 
-    AssetRegistryModule->Get().OnAssetAdded().AddLambda([](const FAssetData& AssetData) {
-        // TO-DO: Fix loading uasset's on 4.23-
-        // BluePrintProvider::AddAsset(AssetData);
-    });
+            MessageEndpoint = FMessageEndpoint::Builder(FName("FAssetEditorManager")).Build();
 
-    RiderLinkModule.ViewModel(ModuleLifetimeDef.lifetime, [this] (rd::Lifetime ModelLifetime, JetBrains::EditorPlugin::RdEditorModel const& UnrealToBackendModel)
-    {
-        UnrealToBackendModel.get_openBlueprint().advise(
-            ModelLifetime,
-            [this, &UnrealToBackendModel](
-            JetBrains::EditorPlugin::BlueprintReference const& s)
+            BluePrintProvider::StartIndexing(AssetRegistryModule->Get());
+
+            IRiderLinkModule::Get().ViewModel(ModuleLifetimeDef.lifetime, [this] (rd::Lifetime ModelLifetime, JetBrains::EditorPlugin::RdEditorModel const& UnrealToBackendModel)
             {
-                try
-                {
-                    AllowSetForeGroundForEditor(UnrealToBackendModel);
+                UnrealToBackendModel.get_openBlueprint().advise(
+                    ModelLifetime,
+                    [this, &UnrealToBackendModel](
+                    JetBrains::EditorPlugin::BlueprintReference const& s)
+                    {
+                        try
+                        {
+                            AllowSetForeGroundForEditor(UnrealToBackendModel);
 
-                    auto Window = FGlobalTabmanager::Get()->GetRootWindow();
-                    if (!Window.IsValid()) return;
+                            auto Window = FGlobalTabmanager::Get()->GetRootWindow();
+                            if (!Window.IsValid()) return;
 
-                    if (Window->IsWindowMinimized())
-                    {
-                        Window->Restore();
+                            if (Window->IsWindowMinimized())
+                            {
+                                Window->Restore();
+                            }
+                            else
+                            {
+                                Window->HACK_ForceToFront();
+                            }
+                            BluePrintProvider::OpenBlueprint(
+                                s.get_pathName(), MessageEndpoint);
+                        }
+                        catch (std::exception const& e)
+                        {
+                            std::cerr << rd::to_string(e);
+                        }
                     }
-                    else
-                    {
-                        Window->HACK_ForceToFront();
-                    }
-                    BluePrintProvider::OpenBlueprint(
-                        s.get_pathName(), MessageEndpoint);
-                }
-                catch (std::exception const& e)
+                );
+
+                UnrealToBackendModel.get_isBlueprintPathName().set([](FString const& pathName) -> bool
                 {
-                    std::cerr << rd::to_string(e);
-                }
-            }
-        );
+                    return BluePrintProvider::IsBlueprint(pathName);
+                });
 
-        UnrealToBackendModel.get_isBlueprintPathName().set([](FString const& pathName) -> bool
-        {
-            return BluePrintProvider::IsBlueprint(pathName);
+                UnrealToBackendModel.get_getPathNameByPath().set([](FString const& path) -> rd::optional<FString>
+                {
+                    TOptional<FString> PathName = BluePrintProvider::GetPathNameByPath(path);
+                    if (!PathName) return {};
+                    return MoveTemp(PathName.GetValue());
+                });
+            });
         });
     });
     UE_LOG(FLogRiderBlueprintModule, Verbose, TEXT("STARTUP FINISH"));
@@ -96,5 +111,11 @@ void FRiderBlueprintModule::ShutdownModule()
 {
     UE_LOG(FLogRiderBlueprintModule, Verbose, TEXT("SHUTDOWN START"));
     ModuleLifetimeDef.terminate();
+    BluePrintProvider::ReleaseLoadedPackages();
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(
+        AssetRegistryConstants::ModuleName))
+    {
+        BluePrintProvider::StopIndexing(AssetRegistryModule->Get());
+    }
     UE_LOG(FLogRiderBlueprintModule, Verbose, TEXT("SHUTDOWN FINISH"));
 }
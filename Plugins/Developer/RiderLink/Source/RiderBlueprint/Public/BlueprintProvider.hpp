@@ -1,17 +1,30 @@
 #pragma once
 
 #include "Delegates/Delegate.h"
+#include "Misc/Optional.h"
 
-struct FAssetData;
 class FMessageEndpoint;
+class IAssetRegistry;
 class UBlueprint;
 
 class RIDERBLUEPRINT_API BluePrintProvider {
 public:
 
-    static void AddAsset(FAssetData const& AssetData);
+    /** Indexes blueprints of the registry so that looking them up doesn't load packages */
+    static void StartIndexing(IAssetRegistry& AssetRegistry);
+
+    static void StopIndexing(IAssetRegistry& AssetRegistry);
+
+    /** Drops the packages prefetched by OpenBlueprint, on module shutdown */
+    static void ReleaseLoadedPackages();
 
     static bool IsBlueprint(FString const& pathName);
 
+    /** Changes whenever answers of IsBlueprint may have changed, lets callers know when to forget them */
+    static uint32 GetIndexGeneration();
+
+    /** Object path of the blueprint which an object path, package name or file name refers to */
+    static TOptional<FString> GetPathNameByPath(FString const& path);
+
     static void OpenBlueprint(FString const& path, TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> const& messageEndpoint);
 };
@@ -8,7 +8,7 @@
 #include "Model/Library/UE4Library/RequestSucceed.Generated.h"
 #include "RdEditorModel/RdEditorModel.Generated.h"
 
-#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Editor/UnrealEdEngine.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Kismet2/DebuggerCommands.h"
@@ -150,6 +150,19 @@ static void UpdateSettings(ULevelEditorPlaySettings* PlayInSettings, const FPlay
 }
 
 
+/**
+ * Play world commands Rider can request, indexes FRiderGameControlActionsCache::Commands.
+ * Play modes come first, so an EPlayModeType is a command too.
+ */
+enum ERiderPlayWorldCommand : uint8
+{
+    RiderCommand_ResumePlaySession = PlayMode_Count,
+    RiderCommand_PausePlaySession,
+    RiderCommand_StopPlaySession,
+    RiderCommand_SingleFrameAdvance,
+    RiderCommand_Count
+};
+
 struct FCachedCommandInfo
 {
     FName CommandName;
@@ -162,11 +175,13 @@ public:
     FRiderGameControlActionsCache();
     ~FRiderGameControlActionsCache();
 
+    /** Game thread only, Command is unset if it isn't registered */
+    const FCachedCommandInfo& Get(uint8 Command);
+
 private:
     void UpdatePlayWorldCommandsCache();
 
-public:
-    FCachedCommandInfo PlayModeCommands[PlayMode_Count] = {
+    FCachedCommandInfo Commands[RiderCommand_Count] = {
         {TEXT("PlayInViewport")},
         {TEXT("PlayInEditorFloating")},
         {TEXT("PlayInMobilePreview")},
@@ -175,32 +190,26 @@ public:
         {TEXT("PlayInNewProcess")},
         {TEXT("PlayInVR")},
         {TEXT("Simulate")},
+        {TEXT("ResumePlaySession")},
+        {TEXT("PausePlaySession")},
+        {TEXT("StopPlaySession")},
+        {TEXT("SingleFrameAdvance")},
     };
-    FCachedCommandInfo ResumePlaySession = {TEXT("ResumePlaySession")};
-    FCachedCommandInfo PausePlaySession = {TEXT("PausePlaySession")};
-    FCachedCommandInfo StopPlaySession = {TEXT("StopPlaySession")};
-    FCachedCommandInfo SingleFrameAdvance = {TEXT("SingleFrameAdvance")};
-
-private:
+    /** Commands are looked up again on the next request, not on every change of the context */
+    bool bStale = true;
     FDelegateHandle CommandsChangedHandle;
 };
 
 FRiderGameControlActionsCache::FRiderGameControlActionsCache()
 {
-    const FName PlayWorldContextName = FName("PlayWorld");
-
-    TSharedPtr<FBindingContext> PlayWorldContext = FInputBindingManager::Get().GetContextByName(PlayWorldContextName);
-    if (PlayWorldContext.IsValid())
-    {
-        UpdatePlayWorldCommandsCache();
-    }
-
+    // registering the play world commands changes the context once per command
     CommandsChangedHandle = FBindingContext::CommandsChanged.AddLambda(
-        [this, PlayWorldContextName](const FBindingContext& Ctx)
+        [this](const FBindingContext& Ctx)
         {
+            static const FName PlayWorldContextName = FName("PlayWorld");
             if (Ctx.GetContextName() == PlayWorldContextName)
             {
-                UpdatePlayWorldCommandsCache();
+                bStale = true;
             }
         }
     );
@@ -211,97 +220,136 @@ FRiderGameControlActionsCache::~FRiderGameControlActionsCache()
     FBindingContext::CommandsChanged.Remove(CommandsChangedHandle);
 }
 
-void FRiderGameControlActionsCache::UpdatePlayWorldCommandsCache()
+const FCachedCommandInfo& FRiderGameControlActionsCache::Get(uint8 Command)
 {
-    FInputBindingManager& BindingManager = FInputBindingManager::Get();
-    auto CacheCommand = [&] (FCachedCommandInfo &Cmd, const FName &ContextName)
+    check(Command < RiderCommand_Count);
+    if (bStale)
     {
-        Cmd.Command = BindingManager.FindCommandInContext(ContextName, Cmd.CommandName);
-    };
+        UpdatePlayWorldCommandsCache();
+    }
+    return Commands[Command];
+}
 
+void FRiderGameControlActionsCache::UpdatePlayWorldCommandsCache()
+{
+    FInputBindingManager& BindingManager = FInputBindingManager::Get();
     const FName PlayWorldContextName = FName("PlayWorld");
-    for (FCachedCommandInfo& PlayModeCommand : PlayModeCommands)
+    if (!BindingManager.GetContextByName(PlayWorldContextName).IsValid()) return;
+
+    for (FCachedCommandInfo& Command : Commands)
     {
-        if (PlayModeCommands->CommandName.IsNone()) continue;
-        CacheCommand(PlayModeCommand, PlayWorldContextName);
+        if (Command.CommandName.IsNone()) continue;
+        Command.Command = BindingManager.FindCommandInContext(PlayWorldContextName, Command.CommandName);
     }
-    CacheCommand(ResumePlaySession, PlayWorldContextName);
-    CacheCommand(PausePlaySession, PlayWorldContextName);
-    CacheCommand(StopPlaySession, PlayWorldContextName);
-    CacheCommand(SingleFrameAdvance, PlayWorldContextName);
+    bStale = false;
 }
 
+using FRiderGameControlActionsCacheRef = TSharedRef<FRiderGameControlActionsCache, ESPMode::ThreadSafe>;
 
-class FRiderGameControl
+/**
+ * Replies and play states are fired right from the game thread, which only async signals allow.
+ * The flags are set in RdEditorModel.Generated.cpp, the model in Rider has to declare both signals async
+ * or regenerating it drops them.
+ */
+static bool IsFiredFromAnyThread(const rd::IRdReactive& Signal)
 {
-public:
-    FRiderGameControl(rd::Lifetime Lifetime, JetBrains::EditorPlugin::RdEditorModel const &Model, FRiderGameControlActionsCache& ActionsCache);
-    ~FRiderGameControl();
-private:
-    void RequestPlayWorldCommand(const FCachedCommandInfo& CommandInfo, int RequestID);
-
-    void SendRequestSucceed(int RequestID);
-    void SendRequestFailed(int RequestID, JetBrains::EditorPlugin::NotificationType Type, const FString& Message);
-
-    void ScheduleModelAction(TFunction<void(JetBrains::EditorPlugin::RdEditorModel const&)> Action);
-
-private:
-    FRiderGameControlActionsCache& Actions;
-    JetBrains::EditorPlugin::RdEditorModel const &Model;
-
-    int32_t playMode;
-
-    FDelegateHandle BeginPIEHandle;
-    FDelegateHandle EndPIEHandle;
-    FDelegateHandle PausePIEHandle;
-    FDelegateHandle ResumePIEHandle;
-    FDelegateHandle SingleStepPIEHandle;
-    FDelegateHandle OnObjectPropertyChangedHandle;
-};
-
+    return ensureMsgf(Signal.async, TEXT("RdEditorModel was generated without async on a signal RiderGameControl fires from the game thread"));
+}
 
-void FRiderGameControl::SendRequestSucceed(int RequestID)
+static void SendRequestResult(const JetBrains::EditorPlugin::RequestResultBase& Result)
 {
-    using namespace JetBrains::EditorPlugin;
-    ScheduleModelAction([=](RdEditorModel const& EditorModel)
+    IRiderLinkModule::Get().FireAsyncAction([&Result](JetBrains::EditorPlugin::RdEditorModel const& Model)
     {
-        EditorModel.get_notificationReplyFromEditor().fire(RequestSucceed(RequestID));
+        if (IsFiredFromAnyThread(Model.get_notificationReplyFromEditor()))
+            Model.get_notificationReplyFromEditor().fire(Result);
     });
 }
 
-void FRiderGameControl::SendRequestFailed(int RequestID, JetBrains::EditorPlugin::NotificationType Type,
-                                          const FString& Message)
+static void SendPlayState(JetBrains::EditorPlugin::PlayState State)
 {
-    using namespace JetBrains::EditorPlugin;
-    ScheduleModelAction([=](RdEditorModel const& EditorModel)
+    IRiderLinkModule::Get().FireAsyncAction([State](JetBrains::EditorPlugin::RdEditorModel const& Model)
     {
-        EditorModel.get_notificationReplyFromEditor().fire(RequestFailed(Type, Message, RequestID));
+        if (IsFiredFromAnyThread(Model.get_playStateFromEditor()))
+            Model.get_playStateFromEditor().fire(State);
     });
 }
 
-void FRiderGameControl::RequestPlayWorldCommand(const FCachedCommandInfo& CommandInfo, int RequestID)
+/** Runs a command Rider requested on the game thread and replies from there */
+class FPlayWorldCommandTask
 {
-    using namespace JetBrains::EditorPlugin;
-    if (!CommandInfo.Command.IsValid())
+public:
+    FPlayWorldCommandTask(TWeakPtr<FRiderGameControlActionsCache, ESPMode::ThreadSafe> InActions, uint8 InCommand,
+                          int InRequestID) :
+        Actions(MoveTemp(InActions)), Command(InCommand), RequestID(InRequestID)
     {
-        const FString Message = FString::Format(TEXT("Command '{0}' was not executed.\nCommand was not registered in Unreal Engine"),
-                                                {CommandInfo.CommandName.ToString()});
-        SendRequestFailed(RequestID, NotificationType::Error, Message);
-        return;
     }
-    AsyncTask(ENamedThreads::GameThread, [=]()
+
+    static ENamedThreads::Type GetDesiredThread() { return ENamedThreads::GameThread; }
+    static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::FireAndForget; }
+    TStatId GetStatId() const { RETURN_QUICK_DECLARE_CYCLE_STAT(FPlayWorldCommandTask, STATGROUP_TaskGraphTasks); }
+
+    void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
     {
+        using namespace JetBrains::EditorPlugin;
+        const TSharedPtr<FRiderGameControlActionsCache, ESPMode::ThreadSafe> PinnedActions = Actions.Pin();
+        if (!PinnedActions.IsValid()) return;
+
+        const FCachedCommandInfo& CommandInfo = PinnedActions->Get(Command);
+        if (!CommandInfo.Command.IsValid())
+        {
+            const FString Message = FString::Format(TEXT("Command '{0}' was not executed.\nCommand was not registered in Unreal Engine"),
+                                                    {CommandInfo.CommandName.ToString()});
+            SendRequestResult(RequestFailed(NotificationType::Error, Message, RequestID));
+            return;
+        }
         if (FPlayWorldCommands::GlobalPlayWorldActions->TryExecuteAction(CommandInfo.Command.ToSharedRef()))
         {
-            SendRequestSucceed(RequestID);
+            SendRequestResult(RequestSucceed(RequestID));
         }
         else
         {
             const FString Message = FString::Format(TEXT("Command '{0}' was not executed.\nRejected by Unreal Engine"),
                                                     {CommandInfo.CommandName.ToString()});
-            SendRequestFailed(RequestID, NotificationType::Message, Message);
+            SendRequestResult(RequestFailed(NotificationType::Message, Message, RequestID));
         }
-    });
+    }
+
+private:
+    TWeakPtr<FRiderGameControlActionsCache, ESPMode::ThreadSafe> Actions;
+    uint8 Command;
+    int RequestID;
+};
+
+
+class FRiderGameControl
+{
+public:
+    FRiderGameControl(rd::Lifetime Lifetime, JetBrains::EditorPlugin::RdEditorModel const &Model, const FRiderGameControlActionsCacheRef& ActionsCache);
+    ~FRiderGameControl();
+private:
+    void RequestPlayWorldCommand(uint8 Command, int RequestID);
+
+    void ScheduleModelAction(TFunction<void(JetBrains::EditorPlugin::RdEditorModel const&)> Action);
+
+private:
+    TWeakPtr<FRiderGameControlActionsCache, ESPMode::ThreadSafe> Actions;
+    JetBrains::EditorPlugin::RdEditorModel const &Model;
+
+    int32_t playMode;
+
+    FDelegateHandle BeginPIEHandle;
+    FDelegateHandle EndPIEHandle;
+    FDelegateHandle PausePIEHandle;
+    FDelegateHandle ResumePIEHandle;
+    FDelegateHandle SingleStepPIEHandle;
+    FDelegateHandle OnObjectPropertyChangedHandle;
+};
+
+
+void FRiderGameControl::RequestPlayWorldCommand(uint8 Command, int RequestID)
+{
+    // graph tasks come from a pooled allocator and keep their arguments inline
+    TGraphTask<FPlayWorldCommandTask>::CreateTask().ConstructAndDispatchWhenReady(Actions, Command, RequestID);
 }
 
 void FRiderGameControl::ScheduleModelAction(TFunction<void(JetBrains::EditorPlugin::RdEditorModel const&)> Action)
@@ -313,7 +361,7 @@ void FRiderGameControl::ScheduleModelAction(TFunction<void(JetBrains::EditorPlug
     });
 }
 
-FRiderGameControl::FRiderGameControl(rd::Lifetime Lifetime, JetBrains::EditorPlugin::RdEditorModel const &Model, FRiderGameControlActionsCache& ActionsCache) :
+FRiderGameControl::FRiderGameControl(rd::Lifetime Lifetime, JetBrains::EditorPlugin::RdEditorModel const &Model, const FRiderGameControlActionsCacheRef& ActionsCache) :
     Actions(ActionsCache), Model(Model)
 {
     using namespace JetBrains::EditorPlugin;
@@ -322,41 +370,26 @@ FRiderGameControl::FRiderGameControl(rd::Lifetime Lifetime, JetBrains::EditorPlu
     Lifetime->bracket(
         [this]()
         {
-            BeginPIEHandle = FEditorDelegates::BeginPIE.AddLambda([this](const bool)
+            BeginPIEHandle = FEditorDelegates::BeginPIE.AddLambda([](const bool)
             {
-                ScheduleModelAction([](RdEditorModel const& model)
-                {
-                    model.get_playStateFromEditor().fire(PlayState::Play);
-                });
+                SendPlayState(PlayState::Play);
             });
-            EndPIEHandle = FEditorDelegates::EndPIE.AddLambda([this](const bool)
+            EndPIEHandle = FEditorDelegates::EndPIE.AddLambda([](const bool)
             {
-                ScheduleModelAction([](RdEditorModel const& model)
-                {
-                    model.get_playStateFromEditor().fire(PlayState::Idle);
-                });
+                SendPlayState(PlayState::Idle);
             });
-            PausePIEHandle = FEditorDelegates::PausePIE.AddLambda([this](const bool)
+            PausePIEHandle = FEditorDelegates::PausePIE.AddLambda([](const bool)
             {
-                ScheduleModelAction([](RdEditorModel const& model)
-                {
-                    model.get_playStateFromEditor().fire(PlayState::Pause);
-                });
+                SendPlayState(PlayState::Pause);
             });
-            ResumePIEHandle = FEditorDelegates::ResumePIE.AddLambda([this](const bool)
+            ResumePIEHandle = FEditorDelegates::ResumePIE.AddLambda([](const bool)
             {
-                ScheduleModelAction([](RdEditorModel const& model)
-                {
-                    model.get_playStateFromEditor().fire(PlayState::Play);
-                });
+                SendPlayState(PlayState::Play);
             });
-            SingleStepPIEHandle = FEditorDelegates::SingleStepPIE.AddLambda([this](const bool)
+            SingleStepPIEHandle = FEditorDelegates::SingleStepPIE.AddLambda([](const bool)
             {
-                ScheduleModelAction([](RdEditorModel const& model)
-                {
-                    model.get_playStateFromEditor().fire(PlayState::Play);
-                    model.get_playStateFromEditor().fire(PlayState::Pause);
-                });
+                SendPlayState(PlayState::Play);
+                SendPlayState(PlayState::Pause);
             });
 
             OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
@@ -399,31 +432,31 @@ FRiderGameControl::FRiderGameControl(rd::Lifetime Lifetime, JetBrains::EditorPlu
                          check(PlayInSettings);
                          const EPlayModeType PlayMode = PlayInSettings->LastExecutedPlayModeType;
 
-                         RequestPlayWorldCommand(Actions.PlayModeCommands[PlayMode], requestID);
+                         RequestPlayWorldCommand(PlayMode, requestID);
                      }
              );
         Model.get_requestPauseFromRider()
              .advise(Lifetime, [this](int requestID)
                      {
-                         RequestPlayWorldCommand(Actions.PausePlaySession, requestID);
+                         RequestPlayWorldCommand(RiderCommand_PausePlaySession, requestID);
                      }
              );
         Model.get_requestResumeFromRider()
              .advise(Lifetime, [this](int requestID)
                      {
-                         RequestPlayWorldCommand(Actions.ResumePlaySession, requestID);
+                         RequestPlayWorldCommand(RiderCommand_ResumePlaySession, requestID);
                      }
              );
         Model.get_requestStopFromRider()
              .advise(Lifetime, [this](int requestID)
                      {
-                         RequestPlayWorldCommand(Actions.StopPlaySession, requestID);
+                         RequestPlayWorldCommand(RiderCommand_StopPlaySession, requestID);
                      }
              );
         Model.get_requestFrameSkipFromRider()
              .advise(Lifetime, [this](int requestID)
                      {
-                         RequestPlayWorldCommand(Actions.SingleFrameAdvance, requestID);
+                         RequestPlayWorldCommand(RiderCommand_SingleFrameAdvance, requestID);
                      }
              );
 
@@ -481,7 +514,7 @@ void FRiderGameControlModule::StartupModule()
     UE_LOG(FLogRiderGameControlModule, Verbose, TEXT("STARTUP START"));
 
     // Actions cache is not related to connection and its lifetimes
-    ActionsCache = MakeUnique<FRiderGameControlActionsCache>();
+    ActionsCache = MakeShared<FRiderGameControlActionsCache, ESPMode::ThreadSafe>();
 
     IRiderLinkModule& RiderLinkModule = IRiderLinkModule::Get();
     ModuleLifetimeDefinition = RiderLinkModule.CreateNestedLifetimeDefinition();
@@ -492,7 +525,7 @@ void FRiderGameControlModule::StartupModule()
         [&](rd::Lifetime ModelLifetime, RdEditorModel const& Model)
         {
             ModelLifetime->add_action([&]() { GameControl.Reset(); });
-            GameControl = MakeUnique<FRiderGameControl>(ModelLifetime, Model, *ActionsCache);
+            GameControl = MakeUnique<FRiderGameControl>(ModelLifetime, Model, ActionsCache.ToSharedRef());
         }
     );
 
@@ -5,6 +5,7 @@
 #include "Logging/LogMacros.h"
 #include "Logging/LogVerbosity.h"
 #include "Modules/ModuleInterface.h"
+#include "Templates/SharedPointer.h"
 #include "Templates/UniquePtr.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(FLogRiderGameControlModule, Log, All);
@@ -26,5 +27,5 @@ public:
 private:
     rd::LifetimeDefinition ModuleLifetimeDefinition;
     TUniquePtr<FRiderGameControl> GameControl;
-    TUniquePtr<FRiderGameControlActionsCache> ActionsCache;
+    TSharedPtr<FRiderGameControlActionsCache, ESPMode::ThreadSafe> ActionsCache;
 };
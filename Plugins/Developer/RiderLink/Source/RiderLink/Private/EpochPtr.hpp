@@ -0,0 +1,45 @@
+#pragma once
+
+#include "util/epoch_guard.h"
+
+#include <atomic>
+
+/**
+ * Pointer read from any thread without locks and replaced by a single writer,
+ * readers are tracked by rd::util::epoch_guard the same way the protocol tracks readers of its subscriptions.
+ * The pointer isn't owned, the writer frees the object once Retire() returns.
+ */
+template <typename T>
+class TEpochPtr
+{
+public:
+	/** Calls Reader with the published object, returns false if there is none */
+	template <typename FuncType>
+	bool Read(FuncType&& Reader) const
+	{
+		const rd::util::epoch_guard::read_section Section(Readers);
+		T* Object = Ptr.load(std::memory_order_seq_cst);
+		if (Object)
+		{
+			Reader(*Object);
+		}
+		return Object != nullptr;
+	}
+
+	/** Writer only, the previous object has to be retired */
+	void Publish(T* Object)
+	{
+		Ptr.store(Object, std::memory_order_seq_cst);
+	}
+
+	/** Writer only, returns when no reader can see the previous object anymore */
+	void Retire()
+	{
+		Ptr.store(nullptr, std::memory_order_seq_cst);
+		Readers.synchronize();
+	}
+
+private:
+	std::atomic<T*> Ptr{nullptr};
+	rd::util::epoch_guard Readers;
+};
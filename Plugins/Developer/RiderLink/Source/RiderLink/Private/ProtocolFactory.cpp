@@ -99,9 +99,14 @@ void ProtocolFactory::InitRdLogging()
 std::shared_ptr<rd::SocketWire::Server> ProtocolFactory::CreateWire(rd::IScheduler* Scheduler, rd::Lifetime SocketLifetime)
 {
     const FString ProjectName = GetProjectName();
+#if defined(RESUME_SESSIONS) && RESUME_SESSIONS == 1
+    constexpr bool bResumeSessions = true;
+#else
+    constexpr bool bResumeSessions = false;
+#endif
     return std::make_shared<rd::SocketWire::Server>(SocketLifetime, Scheduler, 0,
                                                          TCHAR_TO_UTF8(*FString::Printf(TEXT("UnrealEditorServer-%s"),
-                                                             *ProjectName)));
+                                                             *ProjectName)), bResumeSessions);
 }
 
 
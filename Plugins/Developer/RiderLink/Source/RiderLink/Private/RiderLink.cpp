@@ -3,7 +3,6 @@
 #include "ProtocolFactory.h"
 #include "UE4Library/UE4Library.Generated.h"
 
-#include "Misc/ScopeRWLock.h"
 #include "Modules/ModuleManager.h"
 #include "HAL/Platform.h"
 
@@ -23,9 +22,10 @@ void FRiderLinkModule::ShutdownModule()
 void FRiderLinkModule::StartupModule()
 {
 	UE_LOG(FLogRiderLinkModule, Verbose, TEXT("RiderLink STARTUP START"));
-	ProtocolFactory::InitRdLogging();
+	// only the listening socket is set up before Rider connects, and not on the game thread either
 	Scheduler.queue([this]()
 	{
+		ProtocolFactory::InitRdLogging();
 		InitProtocol();
 	});
 	UE_LOG(FLogRiderLinkModule, Verbose, TEXT("RiderLink STARTUP FINISH"));
@@ -48,27 +48,31 @@ void FRiderLinkModule::InitProtocol()
 //			});
 //		}
 //	});
-	Protocol->wire->connected.view(WireLifetime, [this](rd::Lifetime ConnectionLifetime, bool const& IsConnected)
+	// A session outlives short disconnects if the wire resumes them, so the model stays bound
+	// and whatever it sent in the meantime is delivered after reconnect.
+	Protocol->wire->session.view(WireLifetime, [this](rd::Lifetime SessionLifetime, int64_t const& Session)
 	{
-		Scheduler.queue([this, ConnectionLifetime, IsConnected]()
+		Scheduler.queue([this, SessionLifetime, Session]()
 		{
-			if (!IsConnected) return;
+			if (Session == 0 || SessionLifetime->is_terminated()) return;
 
-			FRWScopeLock LockOnConnect(ModelLock, SLT_Write);
+			LiveModel.Retire();
 			EditorModel = MakeUnique<JetBrains::EditorPlugin::RdEditorModel>();
-			EditorModel->connect(ConnectionLifetime, Protocol.Get());
+			EditorModel->connect(SessionLifetime, Protocol.Get());
 			JetBrains::EditorPlugin::UE4Library::serializersOwner.registerSerializersCore(
 				EditorModel->get_serialization_context().get_serializers()
 			);
-			ConnectionLifetime->add_action([&]() mutable
+			SessionLifetime->add_action([&]() mutable
 			{
 				Scheduler.queue([&]()mutable
 				{
-                    FRWScopeLock LockOnDisconnect(ModelLock, SLT_Write);
-                    RdIsModelAlive.set(false);
+					LiveModel.Retire();
+					RdIsModelAlive.set(false);
 				});
 			});
 			RdIsModelAlive.set(true);
+			LiveModel.Publish(EditorModel.Get());
+			RunDeferredStartup();
 		});
 	});
 }
@@ -98,16 +102,45 @@ void FRiderLinkModule::QueueAction(TFunction<void()> Handler)
 	});
 }
 
-bool FRiderLinkModule::FireAsyncAction(TFunction<void(JetBrains::EditorPlugin::RdEditorModel const&)> Handler)
+void FRiderLinkModule::StartWhenConnected(rd::Lifetime Lifetime, TFunction<void()> Handler)
 {
-	FRWScopeLock Lock(ModelLock, SLT_ReadOnly);
-	if(!RdIsModelAlive.has_value()) return false;
-	
-	if(RdIsModelAlive.get())
+#if defined(LAZY_STARTUP) && LAZY_STARTUP == 1
+	Scheduler.invoke_or_queue([this, Lifetime, Handler]
+	{
+		if (Lifetime->is_terminated()) return;
+
+		if (bWasConnected)
+		{
+			Handler();
+		}
+		else
+		{
+			DeferredStartup.Emplace(Lifetime, Handler);
+		}
+	});
+#else
+	Handler();
+#endif
+}
+
+void FRiderLinkModule::RunDeferredStartup()
+{
+	if (bWasConnected) return;
+
+	bWasConnected = true;
+	for (const TPair<rd::Lifetime, TFunction<void()>>& Startup : DeferredStartup)
 	{
-		Handler(*EditorModel.Get());
+		if (!Startup.Key->is_terminated())
+		{
+			Startup.Value();
+		}
 	}
-	return RdIsModelAlive.get();
+	DeferredStartup.Empty();
+}
+
+bool FRiderLinkModule::FireAsyncAction(TFunctionRef<void(JetBrains::EditorPlugin::RdEditorModel const&)> Handler)
+{
+	return LiveModel.Read(Handler);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "EpochPtr.hpp"
 #include "IRiderLink.hpp"
 #include "impl/RdProperty.h"
 #include "lifetime/LifetimeDefinition.h"
@@ -39,10 +40,13 @@ public:
 	                       TFunction<void(rd::Lifetime,
 	                                      JetBrains::EditorPlugin::RdEditorModel const&)> Handler) override;
 	virtual void QueueAction(TFunction<void()> Handler) override;
-	virtual bool FireAsyncAction(TFunction<void(JetBrains::EditorPlugin::RdEditorModel const&)> Handler) override;
+	virtual bool FireAsyncAction(TFunctionRef<void(JetBrains::EditorPlugin::RdEditorModel const&)> Handler) override;
+	virtual void StartWhenConnected(rd::Lifetime Lifetime, TFunction<void()> Handler) override;
 
 private:
 	void InitProtocol();
+	/** Runs what StartWhenConnected deferred, called on Scheduler */
+	void RunDeferredStartup();
 
 	rd::LifetimeDefinition ModuleLifetimeDef{rd::Lifetime::Eternal()};
 	rd::SingleThreadScheduler Scheduler{ModuleLifetimeDef.lifetime, "MainScheduler"};
@@ -50,5 +54,9 @@ private:
 	TUniquePtr<rd::Protocol> Protocol;
 	rd::RdProperty<bool> RdIsModelAlive;
 	TUniquePtr<JetBrains::EditorPlugin::RdEditorModel> EditorModel;
-	FRWLock ModelLock;
+	/** EditorModel while RdIsModelAlive is true, FireAsyncAction reads it from any thread */
+	TEpochPtr<JetBrains::EditorPlugin::RdEditorModel> LiveModel;
+	/** Accessed on Scheduler only */
+	TArray<TPair<rd::Lifetime, TFunction<void()>>> DeferredStartup;
+	bool bWasConnected = false;
 };
@@ -24,5 +24,11 @@ public:
 	virtual rd::LifetimeDefinition CreateNestedLifetimeDefinition() const = 0;
 	virtual void ViewModel(rd::Lifetime Lifetime, TFunction<void(rd::Lifetime, JetBrains::EditorPlugin::RdEditorModel const&)> Handler) = 0;
 	virtual void QueueAction(TFunction<void()> Handler) = 0;
-	virtual bool FireAsyncAction(TFunction<void(JetBrains::EditorPlugin::RdEditorModel const&)> Handler) = 0;
+	virtual bool FireAsyncAction(TFunctionRef<void(JetBrains::EditorPlugin::RdEditorModel const&)> Handler) = 0;
+	/**
+	 * Runs setup which is only needed once Rider is connected.
+	 * With LAZY_STARTUP it waits for the first connection and runs on the protocol thread,
+	 * otherwise it runs right away on the calling thread. Not run if Lifetime ends first.
+	 */
+	virtual void StartWhenConnected(rd::Lifetime Lifetime, TFunction<void()> Handler) = 0;
 };
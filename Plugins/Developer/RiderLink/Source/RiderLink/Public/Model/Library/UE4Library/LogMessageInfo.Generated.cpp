@@ -40,7 +40,11 @@ rd::IPolymorphicSerializable()
 LogMessageInfo LogMessageInfo::read(rd::SerializationCtx& ctx, rd::Buffer & buffer)
 {
     auto type_ = rd::Polymorphic<ELogVerbosity::Type>::read(ctx, buffer);
+#if defined(INTERN_LOG_CATEGORIES) && INTERN_LOG_CATEGORIES == 1
+    auto category_ = __FStringInternedAtProtocolSerializer::read(ctx, buffer);
+#else
     auto category_ = rd::Polymorphic<FString>::read(ctx, buffer);
+#endif
     auto time_ = buffer.read_nullable<rd::DateTime>(
     [&ctx, &buffer]() mutable  
     { return buffer.read_date_time(); }
@@ -52,7 +56,11 @@ LogMessageInfo LogMessageInfo::read(rd::SerializationCtx& ctx, rd::Buffer & buff
 void LogMessageInfo::write(rd::SerializationCtx& ctx, rd::Buffer& buffer) const
 {
     rd::Polymorphic<ELogVerbosity::Type>::write(ctx, buffer, type_);
+#if defined(INTERN_LOG_CATEGORIES) && INTERN_LOG_CATEGORIES == 1
+    __FStringInternedAtProtocolSerializer::write(ctx, buffer, category_);
+#else
     rd::Polymorphic<std::decay_t<decltype(category_)>>::write(ctx, buffer, category_);
+#endif
     buffer.write_nullable<rd::DateTime>(time_, 
     [&ctx, &buffer](rd::DateTime const & it) mutable  -> void 
     { buffer.write_date_time(it); }
@@ -72,6 +72,7 @@ class RIDERLINK_API LogMessageInfo : public rd::IPolymorphicSerializable {
 
 private:
     // custom serializers
+    using __FStringInternedAtProtocolSerializer = rd::InternedSerializer<rd::Polymorphic<FString>, rd::util::getPlatformIndependentHash("Protocol")>;
 
 public:
     // constants
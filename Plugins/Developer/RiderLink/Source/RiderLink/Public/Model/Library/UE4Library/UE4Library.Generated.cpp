@@ -14,6 +14,7 @@
 #include "UE4Library/RequestFailed.Generated.h"
 #include "UE4Library/LogMessageInfo.Generated.h"
 #include "UE4Library/UnrealLogEvent.Generated.h"
+#include "UE4Library/UnrealLogEventBatch.Generated.h"
 #include "UE4Library/UClass.Generated.h"
 #include "UE4Library/BlueprintFunction.Generated.h"
 #include "UE4Library/ScriptCallStackFrame.Generated.h"
@@ -54,6 +55,7 @@ void UE4Library::UE4LibrarySerializersOwner::registerSerializersCore(rd::Seriali
     serializers.registry<RequestFailed>();
     serializers.registry<LogMessageInfo>();
     serializers.registry<UnrealLogEvent>();
+    serializers.registry<UnrealLogEventBatch>();
     serializers.registry<UClass>();
     serializers.registry<BlueprintFunction>();
     serializers.registry<ScriptCallStackFrame>();
@@ -81,7 +83,11 @@ void UE4Library::connect(rd::Lifetime lifetime, rd::IProtocol const * protocol)
 // initializer
 void UE4Library::initialize()
 {
-    serializationHash = 652350108289200731L;
+#if defined(INTERN_LOG_CATEGORIES) && INTERN_LOG_CATEGORIES == 1
+    serializationHash = 990236240034940710L;
+#else
+    serializationHash = 5925238904878974923L;
+#endif
 }
 // primary ctor
 // secondary constructor
@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// <auto-generated>
+//     This code was generated by a RdGen v1.10.
+//
+//     Changes to this file may cause incorrect behavior and will be lost if
+//     the code is regenerated.
+// </auto-generated>
+//------------------------------------------------------------------------------
+#include "UnrealLogEventBatch.Generated.h"
+
+
+
+#ifdef _MSC_VER
+#pragma warning( push )
+#pragma warning( disable:4250 )
+#pragma warning( disable:4307 )
+#pragma warning( disable:4267 )
+#pragma warning( disable:4244 )
+#pragma warning( disable:4100 )
+#endif
+
+namespace JetBrains {
+namespace EditorPlugin {
+// companion
+// constants
+// initializer
+void UnrealLogEventBatch::initialize()
+{
+}
+// primary ctor
+UnrealLogEventBatch::UnrealLogEventBatch(TArray<rd::Wrapper<UnrealLogEvent>> events_) :
+rd::IPolymorphicSerializable()
+,events_(std::move(events_))
+{
+    initialize();
+}
+// secondary constructor
+// default ctors and dtors
+// reader
+UnrealLogEventBatch UnrealLogEventBatch::read(rd::SerializationCtx& ctx, rd::Buffer & buffer)
+{
+    auto events_ = buffer.read_array<TArray, UnrealLogEvent, FDefaultAllocator>(
+    [&ctx, &buffer]() mutable  
+    { return UnrealLogEvent::read(ctx, buffer); }
+    );
+    UnrealLogEventBatch res{std::move(events_)};
+    return res;
+}
+// writer
+void UnrealLogEventBatch::write(rd::SerializationCtx& ctx, rd::Buffer& buffer) const
+{
+    buffer.write_array<TArray, UnrealLogEvent, FDefaultAllocator>(events_, 
+    [&ctx, &buffer](UnrealLogEvent const & it) mutable  -> void 
+    { rd::Polymorphic<std::decay_t<decltype(it)>>::write(ctx, buffer, it); }
+    );
+}
+// virtual init
+// identify
+// getters
+TArray<rd::Wrapper<UnrealLogEvent>> const & UnrealLogEventBatch::get_events() const
+{
+    return events_;
+}
+// intern
+// equals trait
+bool UnrealLogEventBatch::equals(rd::ISerializable const& object) const
+{
+    auto const &other = dynamic_cast<UnrealLogEventBatch const&>(object);
+    if (this == &other) return true;
+    if (this->events_ != other.events_) return false;
+    
+    return true;
+}
+// equality operators
+bool operator==(const UnrealLogEventBatch &lhs, const UnrealLogEventBatch &rhs) {
+    if (lhs.type_name() != rhs.type_name()) return false;
+    return lhs.equals(rhs);
+}
+bool operator!=(const UnrealLogEventBatch &lhs, const UnrealLogEventBatch &rhs){
+    return !(lhs == rhs);
+}
+// hash code trait
+size_t UnrealLogEventBatch::hashCode() const noexcept
+{
+    size_t __r = 0;
+    __r = __r * 31 + (rd::contentDeepHashCode(get_events()));
+    return __r;
+}
+// type name trait
+std::string UnrealLogEventBatch::type_name() const
+{
+    return "UnrealLogEventBatch";
+}
+// static type name trait
+std::string UnrealLogEventBatch::static_type_name()
+{
+    return "UnrealLogEventBatch";
+}
+// polymorphic to string
+std::string UnrealLogEventBatch::toString() const
+{
+    std::string res = "UnrealLogEventBatch\n";
+    res += "\tevents = ";
+    res += rd::to_string(events_);
+    res += '\n';
+    return res;
+}
+// external to string
+std::string to_string(const UnrealLogEventBatch & value)
+{
+    return value.toString();
+}
+}
+}
+
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif
+
@@ -42,15 +42,21 @@ void RdEditorModel::connect(rd::Lifetime lifetime, rd::IProtocol const * protoco
 // initializer
 void RdEditorModel::initialize()
 {
+    logVerbosity_.optimize_nested = true;
+    logCategoryVerbosity_.optimize_nested = true;
+    logCategoryAllowlist_.optimize_nested = true;
     isGameControlModuleInitialized_.optimize_nested = true;
     unrealLog_.async = true;
+    unrealLogBatch_.async = true;
     onBlueprintAdded_.async = true;
-    serializationHash = -6555702035522626840L;
+    playStateFromEditor_.async = true;
+    notificationReplyFromEditor_.async = true;
+    serializationHash = 7025473460665593115L;
 }
 // primary ctor
-RdEditorModel::RdEditorModel(rd::RdSignal<UnrealLogEvent, rd::Polymorphic<UnrealLogEvent>> unrealLog_, rd::RdSignal<BlueprintReference, rd::Polymorphic<BlueprintReference>> openBlueprint_, rd::RdSignal<UClass, rd::Polymorphic<UClass>> onBlueprintAdded_, rd::RdEndpoint<FString, bool, rd::Polymorphic<FString>, rd::Polymorphic<bool>> isBlueprintPathName_, rd::RdEndpoint<FString, rd::optional<FString>, rd::Polymorphic<FString>, RdEditorModel::__FStringNullableSerializer> getPathNameByPath_, rd::RdCall<int32_t, bool, rd::Polymorphic<int32_t>, rd::Polymorphic<bool>> allowSetForegroundWindow_, rd::RdProperty<bool, rd::Polymorphic<bool>> isGameControlModuleInitialized_, rd::RdSignal<PlayState, rd::Polymorphic<PlayState>> playStateFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPlayFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPauseFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestResumeFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestStopFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestFrameSkipFromRider_, rd::RdSignal<RequestResultBase, rd::AbstractPolymorphic<RequestResultBase>> notificationReplyFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromRider_) :
+RdEditorModel::RdEditorModel(rd::RdSignal<UnrealLogEvent, rd::Polymorphic<UnrealLogEvent>> unrealLog_, rd::RdSignal<UnrealLogEventBatch, rd::Polymorphic<UnrealLogEventBatch>> unrealLogBatch_, rd::RdProperty<ELogVerbosity::Type, rd::Polymorphic<ELogVerbosity::Type>> logVerbosity_, rd::RdMap<FString, ELogVerbosity::Type, rd::Polymorphic<FString>, rd::Polymorphic<ELogVerbosity::Type>> logCategoryVerbosity_, rd::RdSet<FString, rd::Polymorphic<FString>> logCategoryAllowlist_, rd::RdSignal<BlueprintReference, rd::Polymorphic<BlueprintReference>> openBlueprint_, rd::RdSignal<UClass, rd::Polymorphic<UClass>> onBlueprintAdded_, rd::RdEndpoint<FString, bool, rd::Polymorphic<FString>, rd::Polymorphic<bool>> isBlueprintPathName_, rd::RdEndpoint<FString, rd::optional<FString>, rd::Polymorphic<FString>, RdEditorModel::__FStringNullableSerializer> getPathNameByPath_, rd::RdCall<int32_t, bool, rd::Polymorphic<int32_t>, rd::Polymorphic<bool>> allowSetForegroundWindow_, rd::RdProperty<bool, rd::Polymorphic<bool>> isGameControlModuleInitialized_, rd::RdSignal<PlayState, rd::Polymorphic<PlayState>> playStateFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPlayFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPauseFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestResumeFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestStopFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestFrameSkipFromRider_, rd::RdSignal<RequestResultBase, rd::AbstractPolymorphic<RequestResultBase>> notificationReplyFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromRider_) :
 rd::RdExtBase()
-,unrealLog_(std::move(unrealLog_)), openBlueprint_(std::move(openBlueprint_)), onBlueprintAdded_(std::move(onBlueprintAdded_)), isBlueprintPathName_(std::move(isBlueprintPathName_)), getPathNameByPath_(std::move(getPathNameByPath_)), allowSetForegroundWindow_(std::move(allowSetForegroundWindow_)), isGameControlModuleInitialized_(std::move(isGameControlModuleInitialized_)), playStateFromEditor_(std::move(playStateFromEditor_)), requestPlayFromRider_(std::move(requestPlayFromRider_)), requestPauseFromRider_(std::move(requestPauseFromRider_)), requestResumeFromRider_(std::move(requestResumeFromRider_)), requestStopFromRider_(std::move(requestStopFromRider_)), requestFrameSkipFromRider_(std::move(requestFrameSkipFromRider_)), notificationReplyFromEditor_(std::move(notificationReplyFromEditor_)), playModeFromEditor_(std::move(playModeFromEditor_)), playModeFromRider_(std::move(playModeFromRider_))
+,unrealLog_(std::move(unrealLog_)), unrealLogBatch_(std::move(unrealLogBatch_)), logVerbosity_(std::move(logVerbosity_)), logCategoryVerbosity_(std::move(logCategoryVerbosity_)), logCategoryAllowlist_(std::move(logCategoryAllowlist_)), openBlueprint_(std::move(openBlueprint_)), onBlueprintAdded_(std::move(onBlueprintAdded_)), isBlueprintPathName_(std::move(isBlueprintPathName_)), getPathNameByPath_(std::move(getPathNameByPath_)), allowSetForegroundWindow_(std::move(allowSetForegroundWindow_)), isGameControlModuleInitialized_(std::move(isGameControlModuleInitialized_)), playStateFromEditor_(std::move(playStateFromEditor_)), requestPlayFromRider_(std::move(requestPlayFromRider_)), requestPauseFromRider_(std::move(requestPauseFromRider_)), requestResumeFromRider_(std::move(requestResumeFromRider_)), requestStopFromRider_(std::move(requestStopFromRider_)), requestFrameSkipFromRider_(std::move(requestFrameSkipFromRider_)), notificationReplyFromEditor_(std::move(notificationReplyFromEditor_)), playModeFromEditor_(std::move(playModeFromEditor_)), playModeFromRider_(std::move(playModeFromRider_))
 {
     initialize();
 }
@@ -67,6 +73,10 @@ void RdEditorModel::init(rd::Lifetime lifetime) const
 {
     rd::RdExtBase::init(lifetime);
     bindPolymorphic(unrealLog_, lifetime, this, "unrealLog");
+    bindPolymorphic(unrealLogBatch_, lifetime, this, "unrealLogBatch");
+    bindPolymorphic(logVerbosity_, lifetime, this, "logVerbosity");
+    bindPolymorphic(logCategoryVerbosity_, lifetime, this, "logCategoryVerbosity");
+    bindPolymorphic(logCategoryAllowlist_, lifetime, this, "logCategoryAllowlist");
     bindPolymorphic(openBlueprint_, lifetime, this, "openBlueprint");
     bindPolymorphic(onBlueprintAdded_, lifetime, this, "onBlueprintAdded");
     bindPolymorphic(isBlueprintPathName_, lifetime, this, "isBlueprintPathName");
@@ -88,6 +98,10 @@ void RdEditorModel::identify(const rd::Identities &identities, rd::RdId const &i
 {
     rd::RdBindableBase::identify(identities, id);
     identifyPolymorphic(unrealLog_, identities, id.mix(".unrealLog"));
+    identifyPolymorphic(unrealLogBatch_, identities, id.mix(".unrealLogBatch"));
+    identifyPolymorphic(logVerbosity_, identities, id.mix(".logVerbosity"));
+    identifyPolymorphic(logCategoryVerbosity_, identities, id.mix(".logCategoryVerbosity"));
+    identifyPolymorphic(logCategoryAllowlist_, identities, id.mix(".logCategoryAllowlist"));
     identifyPolymorphic(openBlueprint_, identities, id.mix(".openBlueprint"));
     identifyPolymorphic(onBlueprintAdded_, identities, id.mix(".onBlueprintAdded"));
     identifyPolymorphic(isBlueprintPathName_, identities, id.mix(".isBlueprintPathName"));
@@ -109,6 +123,22 @@ rd::ISignal<UnrealLogEvent> const & RdEditorModel::get_unrealLog() const
 {
     return unrealLog_;
 }
+rd::ISignal<UnrealLogEventBatch> const & RdEditorModel::get_unrealLogBatch() const
+{
+    return unrealLogBatch_;
+}
+rd::IProperty<ELogVerbosity::Type> const & RdEditorModel::get_logVerbosity() const
+{
+    return logVerbosity_;
+}
+rd::IViewableMap<FString, ELogVerbosity::Type> const & RdEditorModel::get_logCategoryVerbosity() const
+{
+    return logCategoryVerbosity_;
+}
+rd::IViewableSet<FString> const & RdEditorModel::get_logCategoryAllowlist() const
+{
+    return logCategoryAllowlist_;
+}
 rd::ISignal<BlueprintReference> const & RdEditorModel::get_openBlueprint() const
 {
     return openBlueprint_;
@@ -188,6 +218,18 @@ std::string RdEditorModel::toString() const
     res += "\tunrealLog = ";
     res += rd::to_string(unrealLog_);
     res += '\n';
+    res += "\tunrealLogBatch = ";
+    res += rd::to_string(unrealLogBatch_);
+    res += '\n';
+    res += "\tlogVerbosity = ";
+    res += rd::to_string(logVerbosity_);
+    res += '\n';
+    res += "\tlogCategoryVerbosity = ";
+    res += rd::to_string(logCategoryVerbosity_);
+    res += '\n';
+    res += "\tlogCategoryAllowlist = ";
+    res += rd::to_string(logCategoryAllowlist_);
+    res += '\n';
     res += "\topenBlueprint = ";
     res += rd::to_string(openBlueprint_);
     res += '\n';
@@ -45,6 +45,7 @@
 #include "instantiations_RdEditorRoot.h"
 
 #include "UE4Library/UnrealLogEvent.Generated.h"
+#include "UE4Library/UnrealLogEventBatch.Generated.h"
 #include "UE4Library/BlueprintReference.Generated.h"
 #include "UE4Library/UClass.Generated.h"
 #include "Runtime/Core/Public/Containers/UnrealString.h"
@@ -94,6 +95,10 @@ public:
 protected:
     // fields
     rd::RdSignal<UnrealLogEvent, rd::Polymorphic<UnrealLogEvent>> unrealLog_;
+    rd::RdSignal<UnrealLogEventBatch, rd::Polymorphic<UnrealLogEventBatch>> unrealLogBatch_;
+    rd::RdProperty<ELogVerbosity::Type, rd::Polymorphic<ELogVerbosity::Type>> logVerbosity_{ELogVerbosity::All};
+    rd::RdMap<FString, ELogVerbosity::Type, rd::Polymorphic<FString>, rd::Polymorphic<ELogVerbosity::Type>> logCategoryVerbosity_;
+    rd::RdSet<FString, rd::Polymorphic<FString>> logCategoryAllowlist_;
     rd::RdSignal<BlueprintReference, rd::Polymorphic<BlueprintReference>> openBlueprint_;
     rd::RdSignal<UClass, rd::Polymorphic<UClass>> onBlueprintAdded_;
     rd::RdEndpoint<FString, bool, rd::Polymorphic<FString>, rd::Polymorphic<bool>> isBlueprintPathName_;
@@ -117,7 +122,7 @@ private:
 
 public:
     // primary ctor
-    RdEditorModel(rd::RdSignal<UnrealLogEvent, rd::Polymorphic<UnrealLogEvent>> unrealLog_, rd::RdSignal<BlueprintReference, rd::Polymorphic<BlueprintReference>> openBlueprint_, rd::RdSignal<UClass, rd::Polymorphic<UClass>> onBlueprintAdded_, rd::RdEndpoint<FString, bool, rd::Polymorphic<FString>, rd::Polymorphic<bool>> isBlueprintPathName_, rd::RdEndpoint<FString, rd::optional<FString>, rd::Polymorphic<FString>, RdEditorModel::__FStringNullableSerializer> getPathNameByPath_, rd::RdCall<int32_t, bool, rd::Polymorphic<int32_t>, rd::Polymorphic<bool>> allowSetForegroundWindow_, rd::RdProperty<bool, rd::Polymorphic<bool>> isGameControlModuleInitialized_, rd::RdSignal<PlayState, rd::Polymorphic<PlayState>> playStateFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPlayFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPauseFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestResumeFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestStopFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestFrameSkipFromRider_, rd::RdSignal<RequestResultBase, rd::AbstractPolymorphic<RequestResultBase>> notificationReplyFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromRider_);
+    RdEditorModel(rd::RdSignal<UnrealLogEvent, rd::Polymorphic<UnrealLogEvent>> unrealLog_, rd::RdSignal<UnrealLogEventBatch, rd::Polymorphic<UnrealLogEventBatch>> unrealLogBatch_, rd::RdProperty<ELogVerbosity::Type, rd::Polymorphic<ELogVerbosity::Type>> logVerbosity_, rd::RdMap<FString, ELogVerbosity::Type, rd::Polymorphic<FString>, rd::Polymorphic<ELogVerbosity::Type>> logCategoryVerbosity_, rd::RdSet<FString, rd::Polymorphic<FString>> logCategoryAllowlist_, rd::RdSignal<BlueprintReference, rd::Polymorphic<BlueprintReference>> openBlueprint_, rd::RdSignal<UClass, rd::Polymorphic<UClass>> onBlueprintAdded_, rd::RdEndpoint<FString, bool, rd::Polymorphic<FString>, rd::Polymorphic<bool>> isBlueprintPathName_, rd::RdEndpoint<FString, rd::optional<FString>, rd::Polymorphic<FString>, RdEditorModel::__FStringNullableSerializer> getPathNameByPath_, rd::RdCall<int32_t, bool, rd::Polymorphic<int32_t>, rd::Polymorphic<bool>> allowSetForegroundWindow_, rd::RdProperty<bool, rd::Polymorphic<bool>> isGameControlModuleInitialized_, rd::RdSignal<PlayState, rd::Polymorphic<PlayState>> playStateFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPlayFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestPauseFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestResumeFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestStopFromRider_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> requestFrameSkipFromRider_, rd::RdSignal<RequestResultBase, rd::AbstractPolymorphic<RequestResultBase>> notificationReplyFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromEditor_, rd::RdSignal<int32_t, rd::Polymorphic<int32_t>> playModeFromRider_);
     
     // default ctors and dtors
     
@@ -141,6 +146,10 @@ public:
     
     // getters
     rd::ISignal<UnrealLogEvent> const & get_unrealLog() const;
+    rd::ISignal<UnrealLogEventBatch> const & get_unrealLogBatch() const;
+    rd::IProperty<ELogVerbosity::Type> const & get_logVerbosity() const;
+    rd::IViewableMap<FString, ELogVerbosity::Type> const & get_logCategoryVerbosity() const;
+    rd::IViewableSet<FString> const & get_logCategoryAllowlist() const;
     rd::ISignal<BlueprintReference> const & get_openBlueprint() const;
     rd::ISignal<UClass> const & get_onBlueprintAdded() const;
     rd::RdEndpoint<FString, bool, rd::Polymorphic<FString>, rd::Polymorphic<bool>> const & get_isBlueprintPathName() const;
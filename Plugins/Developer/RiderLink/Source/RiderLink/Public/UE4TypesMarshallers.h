@@ -1,6 +1,7 @@
 #pragma once
 
 #include "serialization/Polymorphic.h"
+#include "serialization/InternedSerializer.h"
 #include "std/hash.h"
 
 #include "Containers/UnrealString.h"
@@ -44,6 +45,25 @@ namespace rd {
         size_t operator()(const FString& value) const noexcept;
     };
 
+    /**
+     * InternRoot only knows how to store std::wstring, so interned FString fields go through it.
+     * The wire format is the same as for std::wstring: an id when the scope has a root, the string otherwise.
+     */
+    template <util::hash_t InternKey>
+    class InternedSerializer<Polymorphic<FString>, InternKey, FString> {
+    public:
+        static FString read(SerializationCtx& ctx, Buffer& buffer) {
+            Wrapper<std::wstring> const Value = ctx.readInterned<std::wstring, InternKey>(buffer,
+                [&](SerializationCtx&, Buffer&) { return Polymorphic<std::wstring>::read(ctx, buffer); });
+            return FString(WCHAR_TO_TCHAR(Value->c_str()));
+        }
+
+        static void write(SerializationCtx& ctx, Buffer& buffer, FString const& value) {
+            ctx.writeInterned<std::wstring, InternKey>(buffer, wrapper::make_wrapper<std::wstring>(TCHAR_TO_WCHAR(*value)),
+                [&](SerializationCtx&, Buffer&, std::wstring const&) { Polymorphic<FString>::write(ctx, buffer, value); });
+        }
+    };
+
     // template <typename T>
     // std::string to_string(TArray<T> const& val);
 
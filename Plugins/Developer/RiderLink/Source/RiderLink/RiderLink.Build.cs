@@ -23,6 +23,12 @@ public class RiderLink : ModuleRules
 		};
 		
 		PrivateDefinitions.Add("ENABLE_LOG_FILE=0");
+		// Rider has to resume sessions as well, otherwise it fails the handshake
+		PrivateDefinitions.Add("RESUME_SESSIONS=0");
+		// Rider has to read LogMessageInfo.category as a string interned at the protocol scope as well
+		PrivateDefinitions.Add("INTERN_LOG_CATEGORIES=0");
+		// Modules set up what only a connected Rider needs on the first connection instead of at editor startup
+		PrivateDefinitions.Add("LAZY_STARTUP=1");
 
 		foreach(var Item in Paths)
 		{
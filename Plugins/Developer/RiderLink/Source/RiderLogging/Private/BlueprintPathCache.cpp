@@ -0,0 +1,23 @@
+#include "BlueprintPathCache.hpp"
+
+#include "BlueprintProvider.hpp"
+
+#include "Misc/Crc.h"
+
+bool FBlueprintPathCache::IsBlueprint(const TCHAR* Path, int32 Len)
+{
+	// read before asking the index, a change made meanwhile makes the answer stale on the next call
+	const uint32 Generation = BluePrintProvider::GetIndexGeneration();
+	const uint32 Hash = FCrc::MemCrc32(Path, Len * sizeof(TCHAR));
+	FSlot& Slot = Slots[Hash % NumSlots];
+	if (Slot.Generation == Generation && Slot.Hash == Hash && Slot.Path.Len() == Len && FMemory::Memcmp(*Slot.Path, Path, Len * sizeof(TCHAR)) == 0)
+	{
+		return Slot.bIsBlueprint;
+	}
+
+	Slot.Path = FString(Len, Path);
+	Slot.Hash = Hash;
+	Slot.Generation = Generation;
+	Slot.bIsBlueprint = BluePrintProvider::IsBlueprint(Slot.Path);
+	return Slot.bIsBlueprint;
+}
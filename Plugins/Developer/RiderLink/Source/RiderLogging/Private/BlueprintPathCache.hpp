@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Containers/UnrealString.h"
+
+/**
+ * Remembers recent answers of BluePrintProvider::IsBlueprint, log lines keep mentioning the same few assets.
+ * Slots are picked by hash and overwritten by newer paths, answers given before the blueprint index
+ * changed don't count. Not thread safe.
+ */
+class FBlueprintPathCache
+{
+public:
+	static constexpr uint32 NumSlots = 256;
+
+	bool IsBlueprint(const TCHAR* Path, int32 Len);
+
+private:
+	struct FSlot
+	{
+		FString Path;
+		uint32 Hash = 0;
+		uint32 Generation = 0;
+		bool bIsBlueprint = false;
+	};
+
+	FSlot Slots[NumSlots];
+};
@@ -0,0 +1,111 @@
+#include "LogRangeScanner.hpp"
+
+#include "Math/UnrealMathUtility.h"
+#include "Misc/Char.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+#include <arm_neon.h>
+#endif
+
+namespace LogRangeScanner
+{
+static bool IsIdentChar(TCHAR C)
+{
+	return (C >= '0' && C <= '9') || (C >= 'a' && C <= 'z') || (C >= 'A' && C <= 'Z') || C == '_';
+}
+
+/** Most log lines have neither '/' nor ':', so looking for them eight chars at a time is what makes scanning cheap */
+static const TCHAR* FindChar(const TCHAR* It, const TCHAR* End, TCHAR C)
+{
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		const __m128i Needle = _mm_set1_epi16(static_cast<short>(C));
+		for (; End - It >= 8; It += 8)
+		{
+			const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(It));
+			const uint32 Mask = _mm_movemask_epi8(_mm_cmpeq_epi16(Chars, Needle));
+			if (Mask != 0)
+			{
+				return It + FMath::CountTrailingZeros(Mask) / 2;
+			}
+		}
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+		const uint16x8_t Needle = vdupq_n_u16(static_cast<uint16>(C));
+		for (; End - It >= 8; It += 8)
+		{
+			const uint16x8_t Chars = vld1q_u16(reinterpret_cast<const uint16*>(It));
+			if (vmaxvq_u16(vceqq_u16(Chars, Needle)) != 0)
+			{
+				break;
+			}
+		}
+#endif
+	}
+	for (; It != End; ++It)
+	{
+		if (*It == C) return It;
+	}
+	return End;
+}
+
+void ScanPaths(const TCHAR* Str, int32 Len, TFunctionRef<void(int32 Start, int32 End)> OnRange)
+{
+	const TCHAR* const End = Str + Len;
+	const TCHAR* From = Str;
+	while (true)
+	{
+		const TCHAR* Slash = FindChar(From, End, '/');
+		if (Slash == End) return;
+
+		const TCHAR* WordBegin = Slash;
+		while (WordBegin != From && !FChar::IsWhitespace(WordBegin[-1])) --WordBegin;
+		const TCHAR* WordEnd = Slash + 1;
+		while (WordEnd != End && !FChar::IsWhitespace(*WordEnd)) ++WordEnd;
+
+		// the first slash of a word is the last one the greedy prefix can backtrack to
+		if (WordEnd - Slash > 1)
+		{
+			OnRange(WordBegin - Str, WordEnd - Str);
+		}
+		From = WordEnd;
+	}
+}
+
+void ScanMethods(const TCHAR* Str, int32 Len, TFunctionRef<void(int32 Start, int32 End)> OnRange)
+{
+	const TCHAR* const End = Str + Len;
+	// matches don't overlap, so a class name can't start before the end of the previous one
+	const TCHAR* From = Str;
+	const TCHAR* It = Str;
+	while (true)
+	{
+		const TCHAR* Colon = FindChar(It, End, ':');
+		if (End - Colon < 2) return;
+		if (Colon[1] != ':')
+		{
+			It = Colon + 1;
+			continue;
+		}
+
+		const TCHAR* ClassBegin = Colon;
+		while (ClassBegin != From && IsIdentChar(ClassBegin[-1])) --ClassBegin;
+		const TCHAR* MemberBegin = Colon + 2;
+		if (MemberBegin != End && *MemberBegin == '~') ++MemberBegin;
+		const TCHAR* MemberEnd = MemberBegin;
+		while (MemberEnd != End && IsIdentChar(*MemberEnd)) ++MemberEnd;
+
+		if (ClassBegin != Colon && MemberEnd != MemberBegin)
+		{
+			OnRange(ClassBegin - Str, MemberEnd - Str);
+			From = It = MemberEnd;
+		}
+		else
+		{
+			It = Colon + 1;
+		}
+	}
+}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Templates/Function.h"
+
+/**
+ * Single pass scanners of log lines replacing ICU regexes, they find the same ranges and don't allocate.
+ * OnRange is called with [Start, End) of every match in the order of appearance.
+ */
+namespace LogRangeScanner
+{
+/** Words with a '/' before their last char, as matched by [^\s]*\/[^\s]+ */
+void ScanPaths(const TCHAR* Str, int32 Len, TFunctionRef<void(int32 Start, int32 End)> OnRange);
+
+/** Ident::Ident and Ident::~Ident, as matched by [0-9a-z_A-Z]+::~?[0-9a-z_A-Z]+ */
+void ScanMethods(const TCHAR* Str, int32 Len, TFunctionRef<void(int32 Start, int32 End)> OnRange);
+}
@@ -0,0 +1,51 @@
+#include "RiderLogBatch.hpp"
+
+#include "IRiderLink.hpp"
+#include "Model/Library/UE4Library/UnrealLogEventBatch.Generated.h"
+
+#include "HAL/PlatformTime.h"
+
+void FRiderLogBatch::Add(JetBrains::EditorPlugin::UnrealLogEvent&& Event)
+{
+#if defined(BATCH_LOG_EVENTS) && BATCH_LOG_EVENTS == 1
+	if (Events.Num() == 0)
+	{
+		OpenedAt = FPlatformTime::Seconds();
+	}
+	Chars += Event.get_text().Len();
+	Events.Emplace(MoveTemp(Event));
+
+	if (Events.Num() >= MaxEvents || Chars >= MaxChars)
+	{
+		Flush();
+	}
+#else
+	// Rider reads events one by one, there is nothing to collect
+	IRiderLinkModule::Get().FireAsyncAction(
+	[&Event](JetBrains::EditorPlugin::RdEditorModel const& RdEditorModel)
+	{
+		RdEditorModel.get_unrealLog().fire(Event);
+	});
+#endif
+}
+
+TOptional<double> FRiderLogBatch::GetTimeUntilDue() const
+{
+	if (Events.Num() == 0) return {};
+	return OpenedAt + FlushWindow - FPlatformTime::Seconds();
+}
+
+void FRiderLogBatch::Flush()
+{
+	if (Events.Num() == 0) return;
+
+	TArray<rd::Wrapper<JetBrains::EditorPlugin::UnrealLogEvent>> ToSend = MoveTemp(Events);
+	Events.Reset();
+	Chars = 0;
+
+	IRiderLinkModule::Get().FireAsyncAction(
+	[&ToSend](JetBrains::EditorPlugin::RdEditorModel const& RdEditorModel)
+	{
+		RdEditorModel.get_unrealLogBatch().fire(JetBrains::EditorPlugin::UnrealLogEventBatch(MoveTemp(ToSend)));
+	});
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Misc/Optional.h"
+
+#include "Model/Library/UE4Library/UnrealLogEvent.Generated.h"
+
+/**
+ * Collects log events on the logging scheduler and delivers them to Rider at once,
+ * either when the batch is full or when it has been open for FlushWindow seconds.
+ * Nothing flushes a batch on its own, the logging scheduler waits for GetTimeUntilDue and calls Flush.
+ * Without BATCH_LOG_EVENTS every event is delivered right away and no batch is ever open.
+ * Must only be used from the thread of the logging scheduler.
+ */
+class FRiderLogBatch
+{
+public:
+	static constexpr int32 MaxEvents = 512;
+	static constexpr int32 MaxChars = 64 * 1024;
+	static constexpr double FlushWindow = 0.02;
+
+	void Add(JetBrains::EditorPlugin::UnrealLogEvent&& Event);
+
+	void Flush();
+
+	/** Seconds left until the open batch is due, zero or less once it is, unset if no batch is open */
+	TOptional<double> GetTimeUntilDue() const;
+
+private:
+	TArray<rd::Wrapper<JetBrains::EditorPlugin::UnrealLogEvent>> Events;
+	int32 Chars = 0;
+	double OpenedAt = 0;
+};
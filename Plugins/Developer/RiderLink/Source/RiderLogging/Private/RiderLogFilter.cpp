@@ -0,0 +1,70 @@
+#include "RiderLogFilter.hpp"
+
+#include "Math/UnrealMathUtility.h"
+
+bool FRiderLogFilter::Accepts(ELogVerbosity::Type Verbosity, const FName& Category) const
+{
+	const uint8 Level = Verbosity & ELogVerbosity::VerbosityMask;
+	if (Level > MaxVerbosity.load(std::memory_order_relaxed)) return false;
+	if (!bHasCategoryRules.load(std::memory_order_relaxed)) return true;
+
+	FReadScopeLock Lock(RulesLock);
+	if (AllowedCategories.Num() != 0 && !AllowedCategories.Contains(Category)) return false;
+	const ELogVerbosity::Type* Limit = CategoryVerbosity.Find(Category);
+	return Level <= (Limit ? *Limit : DefaultVerbosity);
+}
+
+void FRiderLogFilter::SetVerbosity(ELogVerbosity::Type Verbosity)
+{
+	FWriteScopeLock Lock(RulesLock);
+	DefaultVerbosity = Verbosity;
+	UpdateFastPath();
+}
+
+void FRiderLogFilter::SetCategoryVerbosity(const FName& Category, TOptional<ELogVerbosity::Type> Verbosity)
+{
+	FWriteScopeLock Lock(RulesLock);
+	if (Verbosity)
+	{
+		CategoryVerbosity.Add(Category, Verbosity.GetValue());
+	}
+	else
+	{
+		CategoryVerbosity.Remove(Category);
+	}
+	UpdateFastPath();
+}
+
+void FRiderLogFilter::SetCategoryAllowed(const FName& Category, bool bAllowed)
+{
+	FWriteScopeLock Lock(RulesLock);
+	if (bAllowed)
+	{
+		AllowedCategories.Add(Category);
+	}
+	else
+	{
+		AllowedCategories.Remove(Category);
+	}
+	UpdateFastPath();
+}
+
+void FRiderLogFilter::Reset()
+{
+	FWriteScopeLock Lock(RulesLock);
+	DefaultVerbosity = ELogVerbosity::All;
+	CategoryVerbosity.Empty();
+	AllowedCategories.Empty();
+	UpdateFastPath();
+}
+
+void FRiderLogFilter::UpdateFastPath()
+{
+	uint8 Max = DefaultVerbosity;
+	for (const TPair<FName, ELogVerbosity::Type>& Rule : CategoryVerbosity)
+	{
+		Max = FMath::Max<uint8>(Max, Rule.Value);
+	}
+	MaxVerbosity.store(Max, std::memory_order_relaxed);
+	bHasCategoryRules.store(CategoryVerbosity.Num() != 0 || AllowedCategories.Num() != 0, std::memory_order_relaxed);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Logging/LogVerbosity.h"
+#include "Misc/Optional.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/NameTypes.h"
+
+#include <atomic>
+
+/**
+ * Verbosity and category rules Rider subscribed to, checked by every thread which logs before the message is copied.
+ * Rules are changed from the protocol thread only and rarely, so a message more verbose than any rule allows
+ * is rejected by a single relaxed load, and the lock is taken only while per category rules exist.
+ */
+class FRiderLogFilter
+{
+public:
+	bool Accepts(ELogVerbosity::Type Verbosity, const FName& Category) const;
+
+	void SetVerbosity(ELogVerbosity::Type Verbosity);
+	/** Unset value makes the category follow the common verbosity again */
+	void SetCategoryVerbosity(const FName& Category, TOptional<ELogVerbosity::Type> Verbosity);
+	/** While any category is allowed explicitly, messages of the others are rejected */
+	void SetCategoryAllowed(const FName& Category, bool bAllowed);
+
+	/** Lets every message through again */
+	void Reset();
+
+private:
+	/** Called with RulesLock taken for writing */
+	void UpdateFastPath();
+
+	mutable FRWLock RulesLock;
+	ELogVerbosity::Type DefaultVerbosity = ELogVerbosity::All;
+	TMap<FName, ELogVerbosity::Type> CategoryVerbosity;
+	TSet<FName> AllowedCategories;
+
+	/** None of the rules lets through messages more verbose than this */
+	std::atomic<uint8> MaxVerbosity{ELogVerbosity::All};
+	std::atomic<bool> bHasCategoryRules{false};
+};
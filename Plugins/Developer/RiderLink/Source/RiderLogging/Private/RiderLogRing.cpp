@@ -0,0 +1,71 @@
+#include "RiderLogRing.hpp"
+
+#include "Misc/CString.h"
+
+static_assert((FRiderLogRing::Capacity & (FRiderLogRing::Capacity - 1)) == 0, "Capacity must be a power of two");
+
+FRiderLogRing::FRiderLogRing() : Slots(MakeUnique<FSlot[]>(Capacity))
+{
+	for (uint64 Pos = 0; Pos < Capacity; ++Pos)
+	{
+		Slots[Pos].Sequence.store(Pos, std::memory_order_relaxed);
+	}
+}
+
+bool FRiderLogRing::Push(const TCHAR* Text, ELogVerbosity::Type Verbosity, const FName& Category, TOptional<double> Time)
+{
+	uint64 Pos = WritePos.load(std::memory_order_relaxed);
+	FSlot* Slot;
+	while (true)
+	{
+		Slot = &Slots[Pos & (Capacity - 1)];
+		const int64 Diff = static_cast<int64>(Slot->Sequence.load(std::memory_order_acquire) - Pos);
+		if (Diff == 0)
+		{
+			if (WritePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed)) break;
+		}
+		else if (Diff < 0)
+		{
+			// the consumer hasn't read this slot since the previous lap
+			Dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			Pos = WritePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	FRecord& Record = Slot->Record;
+	Record.Text.Reset();
+	Record.Text.Append(Text, FCString::Strlen(Text) + 1);
+	Record.Verbosity = Verbosity;
+	Record.Category = Category;
+	Record.Time = Time;
+	Slot->Sequence.store(Pos + 1, std::memory_order_release);
+	return true;
+}
+
+int32 FRiderLogRing::Drain(TFunctionRef<void(const FRecord& Record)> Consumer)
+{
+	int32 Count = 0;
+	while (true)
+	{
+		FSlot& Slot = Slots[ReadPos & (Capacity - 1)];
+		if (Slot.Sequence.load(std::memory_order_acquire) != ReadPos + 1) return Count;
+
+		Consumer(Slot.Record);
+		if (Slot.Record.Text.Max() > MaxPooledText)
+		{
+			Slot.Record.Text.Empty();
+		}
+		Slot.Sequence.store(ReadPos + Capacity, std::memory_order_release);
+		++ReadPos;
+		++Count;
+	}
+}
+
+uint64 FRiderLogRing::TakeDropped()
+{
+	return Dropped.exchange(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Logging/LogVerbosity.h"
+#include "Misc/Optional.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/NameTypes.h"
+
+#include <atomic>
+
+/**
+ * Bounded ring of log records written by any thread and drained by a single consumer.
+ * Writers never wait: a record which finds the ring full is dropped and counted.
+ * Text buffers belong to slots and are reused, so a slot allocates only when it meets a longer message than before.
+ */
+class FRiderLogRing
+{
+public:
+	static constexpr uint32 Capacity = 8192;
+
+	struct FRecord
+	{
+		/** Null terminated */
+		TArray<TCHAR> Text;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::NoLogging;
+		FName Category;
+		TOptional<double> Time;
+	};
+
+	FRiderLogRing();
+
+	bool Push(const TCHAR* Text, ELogVerbosity::Type Verbosity, const FName& Category, TOptional<double> Time);
+
+	/** Passes records to Consumer in the order they were pushed, stops at the first one which isn't written yet */
+	int32 Drain(TFunctionRef<void(const FRecord& Record)> Consumer);
+
+	/** Number of records dropped since the previous call */
+	uint64 TakeDropped();
+
+private:
+	/** Text buffers grown beyond this are released after being drained */
+	static constexpr int32 MaxPooledText = 64 * 1024;
+
+	struct FSlot
+	{
+		/** Equals the position of the write it waits for, or position + 1 when the record is ready to be read */
+		std::atomic<uint64> Sequence{0};
+		FRecord Record;
+	};
+
+	TUniquePtr<FSlot[]> Slots;
+	alignas(64) std::atomic<uint64> WritePos{0};
+	alignas(64) uint64 ReadPos = 0;
+	std::atomic<uint64> Dropped{0};
+};
@@ -1,12 +1,14 @@
 #include "RiderLogging.hpp"
 
-#include "BlueprintProvider.hpp"
+#include "BlueprintPathCache.hpp"
 #include "IRiderLink.hpp"
+#include "LogRangeScanner.hpp"
+#include "RiderLogBatch.hpp"
 #include "Model/Library/UE4Library/LogMessageInfo.Generated.h"
 #include "Model/Library/UE4Library/StringRange.Generated.h"
 #include "Model/Library/UE4Library/UnrealLogEvent.Generated.h"
 
-#include "Internationalization/Regex.h"
+#include "HAL/PlatformProcess.h"
 #include "Misc/DateTime.h"
 #include "Modules/ModuleManager.h"
 
@@ -18,75 +20,75 @@ IMPLEMENT_MODULE(FRiderLoggingModule, RiderLogging);
 
 namespace LoggingExtensionImpl
 {
-static TArray<rd::Wrapper<JetBrains::EditorPlugin::StringRange>> GetPathRanges(
-	const FRegexPattern& Pattern,
-	const FString& Str)
+static TArray<rd::Wrapper<JetBrains::EditorPlugin::StringRange>> GetPathRanges(const FString& Str)
 {
 	using JetBrains::EditorPlugin::StringRange;
-	FRegexMatcher Matcher(Pattern, Str);
+	static FBlueprintPathCache BlueprintPathCache;
 	TArray<rd::Wrapper<StringRange>> Ranges;
-	while (Matcher.FindNext())
+	LogRangeScanner::ScanPaths(*Str, Str.Len(), [&Str, &Ranges](int32 Start, int32 End)
 	{
-		const int Start = Matcher.GetMatchBeginning();
-		const int End = Matcher.GetMatchEnding();
-		FString PathName = Str.Mid(Start, End - Start - 1);
-		if (BluePrintProvider::IsBlueprint(PathName))
+		if (BlueprintPathCache.IsBlueprint(*Str + Start, End - Start - 1))
 			Ranges.Emplace(StringRange(Start, End));
-	}
+	});
 	return Ranges;
 }
 
-static TArray<rd::Wrapper<JetBrains::EditorPlugin::StringRange>> GetMethodRanges(
-	const FRegexPattern& Pattern,
-	const FString& Str)
+static TArray<rd::Wrapper<JetBrains::EditorPlugin::StringRange>> GetMethodRanges(const FString& Str)
 {
 	using JetBrains::EditorPlugin::StringRange;
-	FRegexMatcher Matcher(Pattern, Str);
 	TArray<rd::Wrapper<StringRange>> Ranges;
-	while (Matcher.FindNext())
+	LogRangeScanner::ScanMethods(*Str, Str.Len(), [&Ranges](int32 Start, int32 End)
 	{
-		Ranges.Emplace(StringRange(Matcher.GetMatchBeginning(), Matcher.GetMatchEnding()));
-	}
+		Ranges.Emplace(StringRange(Start, End));
+	});
 	return Ranges;
 }
 
-static bool SendMessageToRider(const JetBrains::EditorPlugin::LogMessageInfo& MessageInfo, const FString& Message)
+static void SendMessageToRider(const JetBrains::EditorPlugin::LogMessageInfo& MessageInfo, const FString& Message,
+                               FRiderLogBatch& LogBatch)
 {
-	static const FRegexPattern PathPattern = FRegexPattern(TEXT("[^\\s]*/[^\\s]+"));
-	static const FRegexPattern MethodPattern = FRegexPattern(TEXT("[0-9a-z_A-Z]+::~?[0-9a-z_A-Z]+"));
-	
-	return IRiderLinkModule::Get().FireAsyncAction(
-	[&MessageInfo, &Message] (JetBrains::EditorPlugin::RdEditorModel const& RdEditorModel)
-	{
-		rd::ISignal<JetBrains::EditorPlugin::UnrealLogEvent> const& UnrealLog = RdEditorModel.get_unrealLog();
-		UnrealLog.fire({
-			MessageInfo,
-			Message,
-			GetPathRanges(PathPattern, Message),
-			GetMethodRanges(MethodPattern, Message)
-		});
+	LogBatch.Add({
+		MessageInfo,
+		Message,
+		GetPathRanges(Message),
+		GetMethodRanges(Message)
 	});
 }
 
-void SendMessageInChunks(FString* Msg, const JetBrains::EditorPlugin::LogMessageInfo& MessageInfo)
+void SendMessageInChunks(FString* Msg, const JetBrains::EditorPlugin::LogMessageInfo& MessageInfo, FRiderLogBatch& LogBatch)
 {
 	static int NUMBER_OF_CHUNKS = 1024;
 	while (!Msg->IsEmpty())
 	{
-		SendMessageToRider(MessageInfo, Msg->Left(NUMBER_OF_CHUNKS));
+		SendMessageToRider(MessageInfo, Msg->Left(NUMBER_OF_CHUNKS), LogBatch);
 		*Msg = Msg->RightChop(NUMBER_OF_CHUNKS);
 	}
 }
 
-void ScheduledSendMessage(FString* Msg, const JetBrains::EditorPlugin::LogMessageInfo& MessageInfo)
+void ScheduledSendMessage(FString* Msg, const JetBrains::EditorPlugin::LogMessageInfo& MessageInfo, FRiderLogBatch& LogBatch)
 {
 	FString ToSend;
 	while (Msg->Split("\n", &ToSend, Msg))
 	{
-		SendMessageInChunks(&ToSend, MessageInfo);
+		SendMessageInChunks(&ToSend, MessageInfo, LogBatch);
 	}
 
-	SendMessageInChunks(Msg, MessageInfo);
+	SendMessageInChunks(Msg, MessageInfo, LogBatch);
+}
+
+static const auto START_TIME = FDateTime::UtcNow().ToUnixTimestamp();
+
+static rd::DateTime GetTimeNow(double Time)
+{
+	return rd::DateTime(START_TIME + static_cast<int64>(Time));
+}
+
+/** Called on the logging scheduler only */
+static const FString& GetCategoryName(const FName& Category)
+{
+	static TMap<FName, FString> CategoryNames;
+	if (const FString* Name = CategoryNames.Find(Category)) return *Name;
+	return CategoryNames.Add(Category, Category.GetPlainNameString());
 }
 }
 
@@ -95,44 +97,123 @@ void FRiderLoggingModule::StartupModule()
 {
 	UE_LOG(FLogRiderLoggingModule, Verbose, TEXT("STARTUP START"));
 
-	static const auto START_TIME = FDateTime::UtcNow().ToUnixTimestamp();
-	static const auto GetTimeNow = [](double Time) -> rd::DateTime
-	{
-		return rd::DateTime(START_TIME + static_cast<int64>(Time));
-	};
-
 	ModuleLifetimeDef = IRiderLinkModule::Get().CreateNestedLifetimeDefinition();
-	LoggingScheduler = MakeUnique<rd::SingleThreadScheduler>(ModuleLifetimeDef.lifetime, "LoggingScheduler");
-	ModuleLifetimeDef.lifetime->bracket(
-	[this]()
+	// nothing is sent before Rider connects, so the output device isn't registered with GLog until then
+	IRiderLinkModule::Get().StartWhenConnected(ModuleLifetimeDef.lifetime, [this]()
 	{
-		OutputDevice.onSerializeMessage.BindLambda(
-		[this](const TCHAR* msg, ELogVerbosity::Type Type, const class FName& Name, TOptional<double> Time)
+		OutputDevice = MakeUnique<FRiderOutputDevice>();
+#if defined(BATCH_LOG_EVENTS) && BATCH_LOG_EVENTS == 1
+		// returned after the scheduler below has stopped, nobody waits for it by then
+		ModuleLifetimeDef.lifetime->bracket(
+		[this]() { DrainEvent = FPlatformProcess::GetSynchEventFromPool(); },
+		[this]()
+		{
+			FPlatformProcess::ReturnSynchEventToPool(DrainEvent);
+			DrainEvent = nullptr;
+		});
+#endif
+		LoggingScheduler = MakeUnique<rd::SingleThreadScheduler>(ModuleLifetimeDef.lifetime, "LoggingScheduler");
+		LogBatch = MakeUnique<FRiderLogBatch>();
+		ModuleLifetimeDef.lifetime->bracket(
+		[this]()
 		{
-			if (Type > ELogVerbosity::All) return;
+			OutputDevice->onSerializeMessage.BindLambda(
+			[this](const TCHAR* msg, ELogVerbosity::Type Type, const class FName& Name, TOptional<double> Time)
+			{
+				if (Type > ELogVerbosity::All) return;
+
+				LogRing.Push(msg, Type, Name, Time);
+#if defined(BATCH_LOG_EVENTS) && BATCH_LOG_EVENTS == 1
+				if (bDrainWaiting)
+				{
+					DrainEvent->Trigger();
+				}
+#endif
+				if (!bDrainQueued.exchange(true))
+				{
+					LoggingScheduler->queue([this]() { DrainLogRing(); });
+				}
+			});
+		},
+		[this]()
+		{
+			if (OutputDevice->onSerializeMessage.IsBound())
+				OutputDevice->onSerializeMessage.Unbind();
+		});
 
-			rd::optional<rd::DateTime> DateTime;
-			if (Time)
+		IRiderLinkModule::Get().ViewModel(ModuleLifetimeDef.lifetime,
+		[this](rd::Lifetime ModelLifetime, JetBrains::EditorPlugin::RdEditorModel const& Model)
+		{
+			FRiderLogFilter& LogFilter = OutputDevice->LogFilter;
+			Model.get_logVerbosity().advise(ModelLifetime, [&LogFilter](ELogVerbosity::Type const& Verbosity)
+			{
+				LogFilter.SetVerbosity(Verbosity);
+			});
+			Model.get_logCategoryVerbosity().advise_add_remove(ModelLifetime,
+			[&LogFilter](rd::AddRemove Kind, FString const& Category, ELogVerbosity::Type const& Verbosity)
 			{
-				DateTime = GetTimeNow(Time.GetValue());
-			}
-			const FString PlainName = Name.GetPlainNameString();
-			const JetBrains::EditorPlugin::LogMessageInfo MessageInfo{Type, PlainName, DateTime};
-			LoggingScheduler->queue([Msg = FString(msg), MessageInfo]() mutable
+				LogFilter.SetCategoryVerbosity(FName(*Category),
+				                               Kind == rd::AddRemove::ADD ? TOptional<ELogVerbosity::Type>(Verbosity) : NullOpt);
+			});
+			Model.get_logCategoryAllowlist().advise(ModelLifetime,
+			[&LogFilter](rd::AddRemove Kind, FString const& Category)
 			{
-				LoggingExtensionImpl::ScheduledSendMessage(&Msg, MessageInfo);
+				LogFilter.SetCategoryAllowed(FName(*Category), Kind == rd::AddRemove::ADD);
 			});
+			// the next Rider starts with its own subscription
+			ModelLifetime->add_action([&LogFilter]() { LogFilter.Reset(); });
 		});
-	},
-	[this]()
-	{
-		if (OutputDevice.onSerializeMessage.IsBound())
-			OutputDevice.onSerializeMessage.Unbind();
 	});
 
 	UE_LOG(FLogRiderLoggingModule, Verbose, TEXT("STARTUP FINISH"));
 }
 
+void FRiderLoggingModule::DrainLogRing()
+{
+	// records pushed after this point queue another drain, the ones pushed before are read below
+	bDrainQueued = false;
+	ReadLogRing();
+
+#if defined(BATCH_LOG_EVENTS) && BATCH_LOG_EVENTS == 1
+	// the open batch is flushed from here once it is due, records pushed meanwhile wake the wait up and join it
+	while (const TOptional<double> TimeUntilDue = LogBatch->GetTimeUntilDue())
+	{
+		if (TimeUntilDue.GetValue() <= 0)
+		{
+			LogBatch->Flush();
+			break;
+		}
+		bDrainWaiting = true;
+		DrainEvent->Wait(static_cast<uint32>(FMath::CeilToInt(TimeUntilDue.GetValue() * 1000)));
+		bDrainWaiting = false;
+		ReadLogRing();
+	}
+#endif
+}
+
+void FRiderLoggingModule::ReadLogRing()
+{
+	LogRing.Drain([this](const FRiderLogRing::FRecord& Record)
+	{
+		rd::optional<rd::DateTime> DateTime;
+		if (Record.Time)
+		{
+			DateTime = LoggingExtensionImpl::GetTimeNow(Record.Time.GetValue());
+		}
+		const JetBrains::EditorPlugin::LogMessageInfo MessageInfo{
+			Record.Verbosity, LoggingExtensionImpl::GetCategoryName(Record.Category), DateTime};
+		FString Msg(Record.Text.Num() - 1, Record.Text.GetData());
+		LoggingExtensionImpl::ScheduledSendMessage(&Msg, MessageInfo, *LogBatch);
+	});
+
+	if (const uint64 Dropped = LogRing.TakeDropped())
+	{
+		const JetBrains::EditorPlugin::LogMessageInfo MessageInfo{ELogVerbosity::Warning, TEXT("LogRiderLogging"), {}};
+		FString Msg = FString::Printf(TEXT("%llu log messages were dropped, logging was faster than sending them to Rider"), Dropped);
+		LoggingExtensionImpl::ScheduledSendMessage(&Msg, MessageInfo, *LogBatch);
+	}
+}
+
 void FRiderLoggingModule::ShutdownModule()
 {
 	UE_LOG(FLogRiderLoggingModule, Verbose, TEXT("SHUTDOWN START"));
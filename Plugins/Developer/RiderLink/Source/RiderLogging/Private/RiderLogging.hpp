@@ -1,7 +1,10 @@
 #pragma once
 
+#include "RiderLogBatch.hpp"
+#include "RiderLogRing.hpp"
 #include "RiderOutputDevice.hpp"
 
+#include "HAL/Event.h"
 #include "Templates/UniquePtr.h"
 
 #include "lifetime/LifetimeDefinition.h"
@@ -25,7 +28,20 @@ public:
     virtual bool SupportsDynamicReloading() override { return true; }
 
 private:
+    /** Sends records of LogRing to Rider, runs on LoggingScheduler */
+    void DrainLogRing();
+    /** Hands the records of LogRing over to LogBatch */
+    void ReadLogRing();
+
+    FRiderLogRing LogRing;
+    std::atomic<bool> bDrainQueued{false};
+#if defined(BATCH_LOG_EVENTS) && BATCH_LOG_EVENTS == 1
+    /** Set while DrainLogRing waits for the open batch to be due, new records trigger DrainEvent then */
+    std::atomic<bool> bDrainWaiting{false};
+    FEvent* DrainEvent = nullptr;
+#endif
     TUniquePtr<rd::SingleThreadScheduler> LoggingScheduler;
-    FRiderOutputDevice OutputDevice;
+    TUniquePtr<FRiderLogBatch> LogBatch;
+    TUniquePtr<FRiderOutputDevice> OutputDevice;
     rd::LifetimeDefinition ModuleLifetimeDef;
 };
@@ -18,10 +18,12 @@ FRiderOutputDevice::~FRiderOutputDevice() {
 }
 
 void FRiderOutputDevice::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) {
+	if (!LogFilter.Accepts(Verbosity, Category)) return;
 	onSerializeMessage.ExecuteIfBound(V, Verbosity, Category, {});
 }
 
 void FRiderOutputDevice::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category,
                                    const double Time) {
+	if (!LogFilter.Accepts(Verbosity, Category)) return;
 	onSerializeMessage.ExecuteIfBound(V, Verbosity, Category, {Time});
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RiderLogFilter.hpp"
+
 #include "Misc/OutputDevice.h"
 #include "Delegates/Delegate.h"
 #include "Logging/LogVerbosity.h"
@@ -12,6 +14,8 @@ public:
 	virtual ~FRiderOutputDevice() override;
 
 	FOnSerializeMessage onSerializeMessage;
+	/** Messages it rejects never reach onSerializeMessage */
+	FRiderLogFilter LogFilter;
 
 protected:
 	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const class FName& Category) override;
@@ -21,5 +21,8 @@ public class RiderLogging : ModuleRules
 			"RiderLink",
 			"RiderBlueprint"
 		});
+
+		// Rider has to listen to unrealLogBatch as well, otherwise batched log events are dropped
+		PrivateDefinitions.Add("BATCH_LOG_EVENTS=0");
 	}
 }
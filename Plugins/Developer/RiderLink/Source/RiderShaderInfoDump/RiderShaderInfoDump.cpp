@@ -1,6 +1,9 @@
 ﻿#include "RiderShaderInfoDump.h"
 
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
 #include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/FileHelper.h"
 #include "Modules/ModuleManager.h"
@@ -8,30 +11,77 @@
 
 IMPLEMENT_MODULE(FRiderShaderInfoDumpModule, RiderShaderInfoDump);
 
+namespace RiderShaderInfoDumpImpl
+{
+/** Bump when the format of FileSystemMappings.ini changes */
+static constexpr uint64 FormatVersion = 1;
+
+static uint64 HashString(const FString& Str, uint64 Seed)
+{
+	return CityHash64WithSeed(reinterpret_cast<const char*>(*Str), Str.Len() * sizeof(TCHAR), Seed);
+}
+
+/** Doesn't depend on the order of the map, full paths depend on the base dir as well */
+static uint64 GetMappingsDigest(const TMap<FString, FString>& ShaderMappings)
+{
+	uint64 Digest = HashString(FPlatformProcess::BaseDir(), FormatVersion);
+	for (const TTuple<FString, FString>& Pair : ShaderMappings)
+	{
+		Digest += HashString(Pair.Value, HashString(Pair.Key, FormatVersion));
+	}
+	return Digest;
+}
+
+static void DumpMappings(const TMap<FString, FString>& ShaderMappings, const FString& IntermediateDir)
+{
+	const FString MappingFile = FPaths::Combine(IntermediateDir, TEXT("FileSystemMappings.ini"));
+	const FString TmpMappingFile = FPaths::Combine(IntermediateDir, TEXT("~FileSystemMappings.ini"));
+	const FString DigestFile = FPaths::Combine(IntermediateDir, TEXT("FileSystemMappings.digest"));
+
+	const FString Digest = FString::Printf(TEXT("%016llx"), GetMappingsDigest(ShaderMappings));
+	FString StoredDigest;
+	if (FFileHelper::LoadFileToString(StoredDigest, *DigestFile) && StoredDigest == Digest &&
+		IFileManager::Get().FileExists(*MappingFile))
+	{
+		return;
+	}
+
+	TArray<FString> Mappings;
+	Mappings.Reserve(ShaderMappings.Num());
+	for(const TTuple<FString, FString>& Pair : ShaderMappings)
+	{
+		Mappings.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key,  *FPaths::ConvertRelativePathToFull(Pair.Value)));
+	}
+	TArray<FString> Result;
+	if (!IFileManager::Get().FileExists(*MappingFile) || !FFileHelper::LoadFileToStringArray(Result, *MappingFile) ||
+		Mappings != Result)
+	{
+		FFileHelper::SaveStringArrayToFile(Mappings, *TmpMappingFile);
+		IFileManager::Get().Move(*MappingFile, *TmpMappingFile, true, true);
+	}
+	FFileHelper::SaveStringToFile(Digest, *DigestFile);
+}
+}
+
 void FRiderShaderInfoDumpModule::StartupModule()
 {
 	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("RiderLink"));
 	if(!Plugin.IsValid()) return;
-	
-	const FString MappingFile = FPaths::Combine(Plugin->GetBaseDir(), TEXT("Intermediate"), TEXT("FileSystemMappings.ini"));
-	const FString TmpMappingFile = FPaths::Combine(Plugin->GetBaseDir(), TEXT("Intermediate"), TEXT("~FileSystemMappings.ini"));
 
-	const TMap<FString, FString> ShaderMappings = AllShaderSourceDirectoryMappings();
-	const TArray<FString> Mappings = [&ShaderMappings]()->TArray<FString>
-	{
-		TArray<FString> Result;
-		for(const TTuple<FString, FString>& Pair : ShaderMappings)
+	// Mappings are registered by modules on the game thread, so they are copied here
+	// and everything else, file access included, is kept off the startup path
+	DumpTask = Async(EAsyncExecution::ThreadPool,
+		[ShaderMappings = AllShaderSourceDirectoryMappings(),
+		 IntermediateDir = FPaths::Combine(Plugin->GetBaseDir(), TEXT("Intermediate"))]()
 		{
-			Result.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key,  *FPaths::ConvertRelativePathToFull(Pair.Value)));
-		}
-		return Result;
-	}();
-	if(IFileManager::Get().FileExists(*MappingFile))
+			RiderShaderInfoDumpImpl::DumpMappings(ShaderMappings, IntermediateDir);
+		});
+}
+
+void FRiderShaderInfoDumpModule::ShutdownModule()
+{
+	if (DumpTask.IsValid())
 	{
-		TArray<FString> Result;
-		FFileHelper::LoadFileToStringArray(Result, *MappingFile);
-		if(Mappings == Result) return;
+		DumpTask.Wait();
 	}
-	FFileHelper::SaveStringArrayToFile(Mappings, *TmpMappingFile);
-	IFileManager::Get().Move(*MappingFile, *TmpMappingFile, true, true);
 }
@@ -1,9 +1,14 @@
 ﻿#pragma once
 
+#include "Async/Future.h"
 #include "Modules/ModuleInterface.h"
 
 class RIDERSHADERINFODUMP_API FRiderShaderInfoDumpModule : public IModuleInterface
 {
 public:
 	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	TFuture<void> DumpTask;
 };